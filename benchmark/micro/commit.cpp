@@ -0,0 +1,58 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+
+#define COMMIT_COUNT 4000
+
+//! Run COMMIT_COUNT small INSERT transactions against an on-disk database, spread over the given amount of connections
+#define CONCURRENT_COMMIT_BENCHMARK(CONNECTIONS)                                                                       \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query("CREATE TABLE IF NOT EXISTS commits(thread INTEGER, i INTEGER, s VARCHAR)");                 \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		vector<std::thread> threads;                                                                                   \
+		for (int32_t t = 0; t < CONNECTIONS; t++) {                                                                    \
+			threads.emplace_back([state, t]() {                                                                        \
+				Connection con(state->db);                                                                             \
+				for (int32_t i = 0; i < COMMIT_COUNT / CONNECTIONS; i++) {                                             \
+					con.Query("INSERT INTO commits VALUES (" + to_string(t) + ", " + to_string(i) + ", 'hello')");     \
+				}                                                                                                      \
+			});                                                                                                        \
+		}                                                                                                              \
+		for (auto &thread : threads) {                                                                                 \
+			thread.join();                                                                                             \
+		}                                                                                                              \
+	}                                                                                                                  \
+	void Cleanup(DuckDBBenchmarkState *state) override {                                                               \
+		state->conn.Query("DELETE FROM commits");                                                                      \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	bool InMemory() override {                                                                                         \
+		return false;                                                                                                  \
+	}
+
+DUCKDB_BENCHMARK(Commit1Connection, "[commit]")
+CONCURRENT_COMMIT_BENCHMARK(1)
+string BenchmarkInfo() override {
+	return "Commit 4000 single-row INSERT transactions to an on-disk database from a single connection";
+}
+FINISH_BENCHMARK(Commit1Connection)
+
+DUCKDB_BENCHMARK(Commit8Connections, "[commit]")
+CONCURRENT_COMMIT_BENCHMARK(8)
+string BenchmarkInfo() override {
+	return "Commit 4000 single-row INSERT transactions to an on-disk database from 8 concurrent connections";
+}
+FINISH_BENCHMARK(Commit8Connections)
+
+DUCKDB_BENCHMARK(Commit32Connections, "[commit]")
+CONCURRENT_COMMIT_BENCHMARK(32)
+string BenchmarkInfo() override {
+	return "Commit 4000 single-row INSERT transactions to an on-disk database from 32 concurrent connections";
+}
+FINISH_BENCHMARK(Commit32Connections)
@@ -0,0 +1,269 @@
+#include "http_range_cache.hpp"
+
+#include "crypto.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/function/table_function.hpp"
+
+namespace duckdb {
+
+static constexpr const char *RANGE_CACHE_EXTENSION = ".block";
+static constexpr const char *TEMPORARY_EXTENSION = ".tmp";
+
+HTTPRangeCache::HTTPRangeCache(FileSystem &fs, string directory_p, idx_t maximum_size)
+    : fs(fs), directory(std::move(directory_p)), maximum_size(maximum_size), current_size(0), tmp_file_count(0),
+      hits(0), misses(0), evictions(0) {
+	if (!fs.DirectoryExists(directory)) {
+		fs.CreateDirectory(directory);
+	}
+	LoadExistingBlocks();
+}
+
+shared_ptr<HTTPRangeCache> HTTPRangeCache::GetOrCreate(ClientContext &context, const string &directory,
+                                                       idx_t maximum_size) {
+	// serialize the creation of the cache, so that all file handles share the same one
+	static mutex create_lock;
+	lock_guard<mutex> guard(create_lock);
+
+	auto &object_cache = ObjectCache::GetObjectCache(context);
+	auto cache = object_cache.Get<HTTPRangeCache>(ObjectType());
+	if (!cache || cache->GetDirectory() != directory) {
+		cache = make_shared<HTTPRangeCache>(FileSystem::GetFileSystem(context), directory, maximum_size);
+		object_cache.Put(ObjectType(), cache);
+	} else {
+		cache->SetMaximumSize(maximum_size);
+	}
+	return cache;
+}
+
+shared_ptr<HTTPRangeCache> HTTPRangeCache::TryGet(ClientContext &context) {
+	return ObjectCache::GetObjectCache(context).Get<HTTPRangeCache>(ObjectType());
+}
+
+string HTTPRangeCache::GetBlockKey(const string &url, const string &version, idx_t block_idx) {
+	auto key = url + "\n" + version + "\n" + to_string(block_idx);
+	hash_bytes hash;
+	hash_str hash_hex;
+	sha256(key.c_str(), key.size(), hash);
+	hex256(hash, hash_hex);
+	return string((char *)hash_hex, sizeof(hash_str)) + RANGE_CACHE_EXTENSION;
+}
+
+string HTTPRangeCache::GetBlockPath(const string &file_name) {
+	return fs.JoinPath(directory, file_name);
+}
+
+void HTTPRangeCache::LoadExistingBlocks() {
+	struct ExistingBlock {
+		string file_name;
+		idx_t size;
+		time_t last_modified;
+	};
+	vector<ExistingBlock> existing_blocks;
+	vector<string> temporary_files;
+	fs.ListFiles(directory, [&](const string &file_name, bool is_dir) {
+		if (!is_dir && StringUtil::EndsWith(file_name, TEMPORARY_EXTENSION)) {
+			// left behind by a block write that was interrupted
+			temporary_files.push_back(file_name);
+			return;
+		}
+		if (is_dir || !StringUtil::EndsWith(file_name, RANGE_CACHE_EXTENSION)) {
+			return;
+		}
+		auto handle = fs.OpenFile(GetBlockPath(file_name), FileFlags::FILE_FLAGS_READ);
+		existing_blocks.push_back({file_name, idx_t(fs.GetFileSize(*handle)), fs.GetLastModifiedTime(*handle)});
+	});
+	for (auto &file_name : temporary_files) {
+		RemoveFileIfExists(GetBlockPath(file_name));
+	}
+	std::sort(existing_blocks.begin(), existing_blocks.end(),
+	          [](const ExistingBlock &a, const ExistingBlock &b) { return a.last_modified < b.last_modified; });
+
+	lock_guard<mutex> guard(lock);
+	for (auto &block : existing_blocks) {
+		AddBlock(block.file_name, block.size);
+	}
+	EvictBlocks();
+}
+
+bool HTTPRangeCache::Read(const string &url, const string &version, idx_t block_idx, data_ptr_t buffer,
+                          idx_t block_size) {
+	auto file_name = GetBlockKey(url, version, block_idx);
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = block_map.find(file_name);
+		if (entry == block_map.end() || entry->second->size != block_size) {
+			misses++;
+			return false;
+		}
+		// move the block to the front of the LRU list
+		blocks.splice(blocks.begin(), blocks, entry->second);
+	}
+	try {
+		auto handle = fs.OpenFile(GetBlockPath(file_name), FileFlags::FILE_FLAGS_READ);
+		fs.Read(*handle, buffer, block_size, 0);
+	} catch (std::exception &ex) {
+		// the block file was removed or truncated in the mean time (possibly by another process): forget about the
+		// block, so that it is fetched from the remote file (and cached again) instead of failing on every read
+		lock_guard<mutex> guard(lock);
+		RemoveBlock(file_name);
+		misses++;
+		return false;
+	}
+	hits++;
+	return true;
+}
+
+bool HTTPRangeCache::Contains(const string &url, const string &version, idx_t block_idx) {
+	auto file_name = GetBlockKey(url, version, block_idx);
+	lock_guard<mutex> guard(lock);
+	return block_map.find(file_name) != block_map.end();
+}
+
+void HTTPRangeCache::Write(const string &url, const string &version, idx_t block_idx, const_data_ptr_t buffer,
+                           idx_t block_size) {
+	if (block_size > maximum_size) {
+		return;
+	}
+	auto file_name = GetBlockKey(url, version, block_idx);
+	{
+		lock_guard<mutex> guard(lock);
+		if (block_map.find(file_name) != block_map.end()) {
+			// already cached by another thread
+			return;
+		}
+	}
+	// write the block to a temporary file first, so the block file is never observed partially written
+	auto path = GetBlockPath(file_name);
+	auto tmp_path = path + "." + to_string(tmp_file_count++) + TEMPORARY_EXTENSION;
+	try {
+		auto handle = fs.OpenFile(tmp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
+		fs.Write(*handle, (void *)buffer, block_size, 0);
+		handle->Close();
+		fs.MoveFile(tmp_path, path);
+	} catch (std::exception &ex) {
+		// failing to cache a block is not an error: the next read fetches it from the remote file again
+		RemoveFileIfExists(tmp_path);
+		return;
+	}
+
+	lock_guard<mutex> guard(lock);
+	if (block_map.find(file_name) == block_map.end()) {
+		AddBlock(file_name, block_size);
+	}
+	EvictBlocks();
+}
+
+void HTTPRangeCache::SetMaximumSize(idx_t maximum_size_p) {
+	maximum_size = maximum_size_p;
+	lock_guard<mutex> guard(lock);
+	EvictBlocks();
+}
+
+HTTPRangeCacheStatistics HTTPRangeCache::GetStatistics() {
+	lock_guard<mutex> guard(lock);
+	return {hits, misses, evictions, blocks.size(), current_size};
+}
+
+void HTTPRangeCache::AddBlock(const string &file_name, idx_t size) {
+	blocks.push_front({file_name, size});
+	block_map[file_name] = blocks.begin();
+	current_size += size;
+}
+
+void HTTPRangeCache::RemoveBlock(const string &file_name) {
+	auto entry = block_map.find(file_name);
+	if (entry == block_map.end()) {
+		return;
+	}
+	RemoveFileIfExists(GetBlockPath(file_name));
+	current_size -= entry->second->size;
+	blocks.erase(entry->second);
+	block_map.erase(entry);
+}
+
+void HTTPRangeCache::EvictBlocks() {
+	while (current_size > maximum_size && !blocks.empty()) {
+		auto &block = blocks.back();
+		RemoveFileIfExists(GetBlockPath(block.file_name));
+		current_size -= block.size;
+		block_map.erase(block.file_name);
+		blocks.pop_back();
+		evictions++;
+	}
+}
+
+void HTTPRangeCache::RemoveFileIfExists(const string &path) {
+	try {
+		fs.RemoveFile(path);
+	} catch (std::exception &ex) {
+		// the file was already removed (e.g., by another process sharing the cache directory)
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// http_range_cache_statistics
+//===--------------------------------------------------------------------===//
+struct HTTPRangeCacheStatisticsData : public GlobalTableFunctionState {
+	HTTPRangeCacheStatisticsData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> HTTPRangeCacheStatisticsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                             vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("directory");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("block_count");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("size");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> HTTPRangeCacheStatisticsInit(ClientContext &context,
+                                                                         TableFunctionInitInput &input) {
+	return make_uniq<HTTPRangeCacheStatisticsData>();
+}
+
+static void HTTPRangeCacheStatisticsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<HTTPRangeCacheStatisticsData>();
+	if (data.finished) {
+		return;
+	}
+	data.finished = true;
+	auto cache = HTTPRangeCache::TryGet(context);
+	if (!cache) {
+		// the range cache has not been used (yet)
+		return;
+	}
+	auto statistics = cache->GetStatistics();
+	output.SetValue(0, 0, Value(cache->GetDirectory()));
+	output.SetValue(1, 0, Value::UBIGINT(statistics.hits));
+	output.SetValue(2, 0, Value::UBIGINT(statistics.misses));
+	output.SetValue(3, 0, Value::UBIGINT(statistics.evictions));
+	output.SetValue(4, 0, Value::UBIGINT(statistics.block_count));
+	output.SetValue(5, 0, Value::UBIGINT(statistics.size));
+	output.SetCardinality(1);
+}
+
+TableFunction HTTPRangeCache::GetStatisticsFunction() {
+	return TableFunction("http_range_cache_statistics", {}, HTTPRangeCacheStatisticsFunction,
+	                     HTTPRangeCacheStatisticsBind, HTTPRangeCacheStatisticsInit);
+}
+
+} // namespace duckdb
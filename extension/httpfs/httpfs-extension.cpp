@@ -3,6 +3,8 @@
 #include "duckdb.hpp"
 #include "httpfs-extension.hpp"
 
+#include "duckdb/main/extension_util.hpp"
+#include "http_range_cache.hpp"
 #include "s3fs.hpp"
 
 namespace duckdb {
@@ -29,6 +31,11 @@ static void LoadInternal(DatabaseInstance &instance) {
 	config.AddExtensionOption("http_retry_backoff",
 	                          "Backoff factor for exponentially increasing retry wait time (default 4)",
 	                          LogicalType::FLOAT, Value(4));
+	config.AddExtensionOption("http_range_cache_directory",
+	                          "Local directory in which byte ranges of remote files are cached (disabled if not set)",
+	                          LogicalType::VARCHAR);
+	config.AddExtensionOption("http_range_cache_size", "Maximum size of the HTTP range cache (default 1GB)",
+	                          LogicalType::VARCHAR, Value("1GB"));
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR);
 	config.AddExtensionOption("s3_access_key_id", "S3 Access Key ID", LogicalType::VARCHAR);
@@ -54,6 +61,8 @@ static void LoadInternal(DatabaseInstance &instance) {
 
 	auto provider = make_uniq<AWSEnvironmentCredentialsProvider>(config);
 	provider->SetAll();
+
+	ExtensionUtil::RegisterFunction(instance, HTTPRangeCache::GetStatisticsFunction());
 }
 
 void HTTPFsExtension::Load(DuckDB &db) {
@@ -50,8 +50,17 @@ HTTPParams HTTPParams::ReadFrom(FileOpener *opener) {
 	if (FileOpener::TryGetCurrentSetting(opener, "http_retry_backoff", value)) {
 		retry_backoff = value.GetValue<float>();
 	}
+	string range_cache_directory;
+	uint64_t range_cache_size = DEFAULT_RANGE_CACHE_SIZE;
+	if (FileOpener::TryGetCurrentSetting(opener, "http_range_cache_directory", value) && !value.IsNull()) {
+		range_cache_directory = value.ToString();
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_range_cache_size", value)) {
+		range_cache_size = DBConfig::ParseMemoryLimit(value.ToString());
+	}
 
-	return {timeout, retries, retry_wait_ms, retry_backoff, force_download};
+	return {timeout,        retries, retry_wait_ms, retry_backoff, force_download, std::move(range_cache_directory),
+	        range_cache_size};
 }
 
 void HTTPFileSystem::ParseUrl(string &url, string &path_out, string &proto_host_port_out) {
@@ -353,8 +362,8 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, string path, uint8_t flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
-      file_offset(0), buffer_start(0), buffer_end(0) {
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), last_modified(0), buffer_available(0),
+      buffer_idx(0), file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, uint8_t flags, FileLockType lock,
@@ -390,7 +399,7 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 	// Don't buffer when DirectIO is set.
 	if (hfh.flags & FileFlags::FILE_FLAGS_DIRECT_IO && to_read > 0) {
-		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
+		ReadRange(hfh, location, (char *)buffer, to_read);
 		hfh.buffer_available = 0;
 		hfh.buffer_idx = 0;
 		hfh.file_offset = location + nr_bytes;
@@ -426,14 +435,13 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 			// Bypass buffer if we read more than buffer size
 			if (to_read > new_buffer_available) {
-				GetRangeRequest(hfh, hfh.path, {}, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
+				ReadRange(hfh, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
 				hfh.buffer_available = 0;
 				hfh.buffer_idx = 0;
 				hfh.file_offset += to_read;
 				break;
 			} else {
-				GetRangeRequest(hfh, hfh.path, {}, hfh.file_offset, (char *)hfh.read_buffer.get(),
-				                new_buffer_available);
+				ReadRange(hfh, hfh.file_offset, (char *)hfh.read_buffer.get(), new_buffer_available);
 				hfh.buffer_available = new_buffer_available;
 				hfh.buffer_idx = 0;
 				hfh.buffer_start = hfh.file_offset;
@@ -443,6 +451,54 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	}
 }
 
+void HTTPFileSystem::ReadRange(HTTPFileHandle &hfh, idx_t file_offset, char *buffer_out, idx_t buffer_out_len) {
+	// cached blocks are tied to the version of the file: files without an ETag or Last-Modified header are not cached
+	string version = !hfh.etag.empty() ? hfh.etag : hfh.last_modified != 0 ? to_string(hfh.last_modified) : "";
+	if (!hfh.range_cache || version.empty() || file_offset + buffer_out_len > hfh.length) {
+		GetRangeRequest(hfh, hfh.path, {}, file_offset, buffer_out, buffer_out_len);
+		return;
+	}
+	auto &cache = *hfh.range_cache;
+	const auto block_size = HTTPRangeCache::BLOCK_SIZE;
+	auto read_end = file_offset + buffer_out_len;
+	auto block_end = (read_end + block_size - 1) / block_size;
+	// the size of block "block_idx" (the last block of the file can be smaller)
+	auto get_block_size = [&](idx_t block_idx) {
+		return MinValue<idx_t>(block_size, hfh.length - block_idx * block_size);
+	};
+	// copy the requested part of the blocks starting at "block_idx" into the output buffer
+	auto copy_blocks = [&](idx_t block_idx, data_ptr_t data, idx_t data_len) {
+		auto data_start = block_idx * block_size;
+		auto copy_start = MaxValue<idx_t>(data_start, file_offset);
+		auto copy_end = MinValue<idx_t>(data_start + data_len, read_end);
+		memcpy(buffer_out + copy_start - file_offset, data + copy_start - data_start, copy_end - copy_start);
+	};
+
+	auto block_buffer = duckdb::unique_ptr<data_t[]>(new data_t[block_size]);
+	auto block_idx = file_offset / block_size;
+	while (block_idx < block_end) {
+		if (cache.Read(hfh.path, version, block_idx, block_buffer.get(), get_block_size(block_idx))) {
+			copy_blocks(block_idx, block_buffer.get(), get_block_size(block_idx));
+			block_idx++;
+			continue;
+		}
+		// fetch the blocks up to the next cached block with a single request
+		auto fetch_end = block_idx + 1;
+		while (fetch_end < block_end && !cache.Contains(hfh.path, version, fetch_end)) {
+			fetch_end++;
+		}
+		auto fetch_start = block_idx * block_size;
+		auto fetch_len = MinValue<idx_t>(fetch_end * block_size, hfh.length) - fetch_start;
+		auto fetch_buffer = duckdb::unique_ptr<data_t[]>(new data_t[fetch_len]);
+		GetRangeRequest(hfh, hfh.path, {}, fetch_start, (char *)fetch_buffer.get(), fetch_len);
+		copy_blocks(block_idx, fetch_buffer.get(), fetch_len);
+		for (; block_idx < fetch_end; block_idx++) {
+			cache.Write(hfh.path, version, block_idx, fetch_buffer.get() + block_idx * block_size - fetch_start,
+			            get_block_size(block_idx));
+		}
+	}
+}
+
 int64_t HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &hfh = (HTTPFileHandle &)handle;
 	idx_t max_read = hfh.length - hfh.file_offset;
@@ -531,6 +587,13 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 		throw InternalException("State was not defined in this HTTP File Handle");
 	}
 
+	auto client_context = FileOpener::TryGetClientContext(opener);
+	if (client_context && !http_params.range_cache_directory.empty() && (flags & FileFlags::FILE_FLAGS_READ) &&
+	    !(flags & FileFlags::FILE_FLAGS_WRITE)) {
+		range_cache = HTTPRangeCache::GetOrCreate(*client_context, http_params.range_cache_directory,
+		                                          http_params.range_cache_size);
+	}
+
 	auto current_cache = TryGetMetadataCache(opener, hfs);
 
 	bool should_write_cache = false;
@@ -542,6 +605,7 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags & FileFlags::FILE_FLAGS_READ) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
@@ -641,8 +705,10 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 		last_modified = mktime(&tm);
 	}
 
+	etag = res->headers["ETag"];
+
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
 	}
 }
 
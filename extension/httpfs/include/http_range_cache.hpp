@@ -0,0 +1,107 @@
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+class FileSystem;
+class TableFunction;
+
+struct HTTPRangeCacheStatistics {
+	//! The number of block reads that were served from the cache
+	idx_t hits;
+	//! The number of block reads that had to be fetched from the remote file
+	idx_t misses;
+	//! The number of blocks that were evicted from the cache
+	idx_t evictions;
+	//! The number of blocks currently in the cache
+	idx_t block_count;
+	//! The total size of the blocks currently in the cache
+	idx_t size;
+};
+
+//! Persistent cache of byte ranges of remote files, stored as one file per block in a local directory.
+//! Blocks are aligned to BLOCK_SIZE and are identified by the URL and the version (ETag or Last-Modified) of the remote
+//! file, so a modified file is never served from the cache. The least recently used blocks are evicted once the total
+//! size of the cache exceeds its limit.
+class HTTPRangeCache : public ObjectCacheEntry {
+public:
+	//! The size of the (aligned) byte ranges that are cached
+	static constexpr idx_t BLOCK_SIZE = 1 << 20;
+
+	HTTPRangeCache(FileSystem &fs, string directory, idx_t maximum_size);
+
+	//! Get the range cache in the given directory, creating it (and loading its existing blocks) if required
+	static shared_ptr<HTTPRangeCache> GetOrCreate(ClientContext &context, const string &directory, idx_t maximum_size);
+	//! Get the range cache of the database (if any)
+	static shared_ptr<HTTPRangeCache> TryGet(ClientContext &context);
+
+	//! Read block "block_idx" of version "version" of the file at "url" into "buffer". Returns false if it is not
+	//! cached.
+	bool Read(const string &url, const string &version, idx_t block_idx, data_ptr_t buffer, idx_t block_size);
+	//! Whether block "block_idx" of version "version" of the file at "url" is cached
+	bool Contains(const string &url, const string &version, idx_t block_idx);
+	//! Write block "block_idx" of version "version" of the file at "url" to the cache
+	void Write(const string &url, const string &version, idx_t block_idx, const_data_ptr_t buffer, idx_t block_size);
+
+	const string &GetDirectory() const {
+		return directory;
+	}
+	void SetMaximumSize(idx_t maximum_size);
+	HTTPRangeCacheStatistics GetStatistics();
+
+	//! The http_range_cache_statistics table function, which returns the statistics of the range cache
+	static TableFunction GetStatisticsFunction();
+
+	static string ObjectType() {
+		return "http_range_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	struct CachedBlock {
+		string file_name;
+		idx_t size;
+	};
+
+	static string GetBlockKey(const string &url, const string &version, idx_t block_idx);
+	string GetBlockPath(const string &key);
+	//! Load the blocks that were cached by previous sessions, from least to most recently written
+	void LoadExistingBlocks();
+	//! Add a block as the most recently used one
+	void AddBlock(const string &file_name, idx_t size);
+	//! Forget about a block (if it is still cached), e.g. because its file could not be read
+	void RemoveBlock(const string &file_name);
+	//! Evict the least recently used blocks until the cache fits within its maximum size
+	void EvictBlocks();
+	void RemoveFileIfExists(const string &path);
+
+	//! The local file system
+	FileSystem &fs;
+	//! The directory in which the blocks are stored
+	const string directory;
+	//! The maximum total size of the cached blocks
+	atomic<idx_t> maximum_size;
+
+	mutex lock;
+	//! The cached blocks, ordered from most to least recently used
+	list<CachedBlock> blocks;
+	//! File name -> position in the LRU list
+	unordered_map<string, list<CachedBlock>::iterator> block_map;
+	//! The total size of the cached blocks
+	idx_t current_size;
+	//! Used to give the temporary files that blocks are written to unique names
+	atomic<idx_t> tmp_file_count;
+
+	atomic<idx_t> hits;
+	atomic<idx_t> misses;
+	atomic<idx_t> evictions;
+};
+
+} // namespace duckdb
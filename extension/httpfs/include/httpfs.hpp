@@ -6,6 +6,7 @@
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "http_metadata_cache.hpp"
+#include "http_range_cache.hpp"
 
 namespace duckdb_httplib_openssl {
 struct Response;
@@ -34,12 +35,16 @@ struct HTTPParams {
 	static constexpr uint64_t DEFAULT_RETRY_WAIT_MS = 100;
 	static constexpr float DEFAULT_RETRY_BACKOFF = 4;
 	static constexpr bool DEFAULT_FORCE_DOWNLOAD = false;
+	static constexpr uint64_t DEFAULT_RANGE_CACHE_SIZE = 1000000000; // 1GB
 
 	uint64_t timeout;
 	uint64_t retries;
 	uint64_t retry_wait_ms;
 	float retry_backoff;
 	bool force_download;
+	//! The directory of the persistent byte-range cache (disabled if empty)
+	string range_cache_directory;
+	uint64_t range_cache_size;
 
 	static HTTPParams ReadFrom(FileOpener *opener);
 };
@@ -60,6 +65,7 @@ public:
 	uint8_t flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
 	bool range_read = true;
 
 	// Read info
@@ -74,6 +80,8 @@ public:
 	constexpr static idx_t READ_BUFFER_LEN = 1000000;
 
 	shared_ptr<HTTPState> state;
+	//! The persistent byte-range cache (if enabled)
+	shared_ptr<HTTPRangeCache> range_cache;
 
 public:
 	void Close() override {
@@ -142,6 +150,9 @@ public:
 	duckdb::unique_ptr<HTTPMetadataCache> global_metadata_cache;
 
 protected:
+	//! Read the range [file_offset, file_offset + buffer_out_len) of the file, from the range cache if possible
+	void ReadRange(HTTPFileHandle &handle, idx_t file_offset, char *buffer_out, idx_t buffer_out_len);
+
 	virtual duckdb::unique_ptr<HTTPFileHandle> CreateHandle(const string &path, uint8_t flags, FileLockType lock,
 	                                                        FileCompressionType compression, FileOpener *opener);
 };
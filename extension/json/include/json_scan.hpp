@@ -229,6 +229,7 @@ private:
 	void ParseNextChunk();
 
 	void ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
+	bool ParseProjectedJSON(const char *const json_start, const idx_t json_size);
 	void ThrowObjectSizeError(const idx_t object_size);
 	void ThrowInvalidAtEndError();
 
@@ -253,6 +254,14 @@ private:
 
 	//! Buffer to reconstruct split values
 	AllocatedData reconstruct_buffer;
+
+	//! Whether only the projected keys of the records are parsed (if not all columns are projected)
+	bool projected_scan;
+	//! The keys that are projected
+	json_key_set_t projected_keys;
+	uint64_t projected_key_filter;
+	//! Buffer for the positions of the members of a record
+	vector<const char *> member_ends;
 };
 
 struct JSONGlobalTableFunctionState : public GlobalTableFunctionState {
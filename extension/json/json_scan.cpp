@@ -1,5 +1,6 @@
 #include "json_scan.hpp"
 
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/enum_util.hpp"
 #include "duckdb/common/multi_file_reader.hpp"
 #include "duckdb/main/extension_helper.hpp"
@@ -174,6 +175,14 @@ JSONScanGlobalState::JSONScanGlobalState(ClientContext &context, const JSONScanD
       system_threads(TaskScheduler::GetScheduler(context).NumberOfThreads()) {
 }
 
+//! Cheap filter to rule out keys that are not projected before probing the hash set
+static inline uint64_t JSONKeyFilterBit(const char *key, const idx_t length) {
+	if (length == 0) {
+		return 1;
+	}
+	return uint64_t(1) << ((length * 31 + uint8_t(key[0]) * 7 + uint8_t(key[length - 1])) & 63);
+}
+
 JSONScanLocalState::JSONScanLocalState(ClientContext &context, JSONScanGlobalState &gstate)
     : scan_count(0), batch_index(DConstants::INVALID_INDEX), total_read_size(0), total_tuple_count(0),
       bind_data(gstate.bind_data), allocator(BufferAllocator::Get(context)), current_reader(nullptr),
@@ -181,6 +190,18 @@ JSONScanLocalState::JSONScanLocalState(ClientContext &context, JSONScanGlobalSta
 
 	// Buffer to reconstruct JSON values when they cross a buffer boundary
 	reconstruct_buffer = gstate.allocator.Allocate(gstate.buffer_capacity);
+
+	// If only some of the columns are projected, we only parse the values of the projected keys of the records
+	projected_scan = bind_data.type == JSONScanType::READ_JSON &&
+	                 bind_data.options.record_type == JSONRecordType::RECORDS &&
+	                 gstate.names.size() < bind_data.names.size();
+	projected_key_filter = 0;
+	if (projected_scan) {
+		for (const auto &name : gstate.names) {
+			projected_keys.insert({name.c_str(), name.length()});
+			projected_key_filter |= JSONKeyFilterBit(name.c_str(), name.length());
+		}
+	}
 }
 
 JSONGlobalTableFunctionState::JSONGlobalTableFunctionState(ClientContext &context, TableFunctionInitInput &input)
@@ -396,7 +417,207 @@ static inline void TrimWhitespace(JSONString &line) {
 	}
 }
 
+static constexpr uint64_t BroadcastByte(const uint8_t byte) {
+	return 0x0101010101010101ULL * byte;
+}
+
+//! Sets the high bit of every byte in "word" that equals "byte"
+static inline uint64_t BytesEqualMask(const uint64_t word, const uint8_t byte) {
+	const auto xored = word ^ BroadcastByte(byte);
+	return ~(((xored & BroadcastByte(0x7F)) + BroadcastByte(0x7F)) | xored | BroadcastByte(0x7F));
+}
+
+//! Gathers the high bits of the bytes in "mask" so that bit i of the result corresponds to byte i
+static inline uint8_t MaskToBits(const uint64_t mask) {
+	return uint8_t(((mask >> 7) * 0x0102040810204080ULL) >> 56);
+}
+
+static inline const char *SkipJSONWhitespace(const char *ptr, const char *const end) {
+	for (; ptr != end; ptr++) {
+		const auto &c = *ptr;
+		if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+			break;
+		}
+	}
+	return ptr;
+}
+
+//! Skips to the character after the closing quote of a string, "ptr" should point after the opening quote
+static inline const char *SkipJSONString(const char *ptr, const char *const end, bool &escaped) {
+	for (; ptr != end; ptr++) {
+		const auto &c = *ptr;
+		if (c == '"') {
+			return ptr + 1;
+		} else if (c == '\\') {
+			escaped = true;
+			if (++ptr == end) {
+				break;
+			}
+		}
+	}
+	return nullptr;
+}
+
+//! Finds the commas that separate the members of the JSON object that starts at "ptr", and its closing brace.
+//! The object is scanned 8 bytes at a time: the brackets and commas within strings are masked out using a prefix XOR
+//! of the quotes, words with escape sequences are handled byte by byte. Values are not parsed, only the nesting of the
+//! brackets and the termination of the strings is checked. Returns nullptr if the object is malformed
+static const char *FindJSONMembers(const char *ptr, const char *const end, vector<const char *> &member_ends,
+                                   idx_t &member_count) {
+	D_ASSERT(*ptr == '{');
+	static constexpr idx_t MAXIMUM_DEPTH = 64;
+	uint64_t object_bits = 0; // Bit i is set if the container at depth i + 1 is an object (and not an array)
+	int64_t depth = 0;
+	bool in_string = false;
+	bool escaped = false;
+	bool error = false;
+	member_count = 0;
+	for (; ptr < end; ptr += sizeof(uint64_t)) {
+		const auto size = MinValue<idx_t>(end - ptr, sizeof(uint64_t));
+		uint64_t word = 0;
+		if (size == sizeof(uint64_t)) {
+			memcpy(&word, ptr, sizeof(uint64_t));
+		} else {
+			memcpy(&word, ptr, size);
+		}
+
+		// Bit i is set if byte i is within a string
+		uint8_t string_bits = 0;
+		if (!escaped && BytesEqualMask(word, '\\') == 0) {
+			string_bits = MaskToBits(BytesEqualMask(word, '"'));
+			string_bits ^= uint8_t(string_bits << 1);
+			string_bits ^= uint8_t(string_bits << 2);
+			string_bits ^= uint8_t(string_bits << 4);
+			if (in_string) {
+				string_bits = ~string_bits;
+			}
+			in_string = string_bits & 0x80;
+		} else {
+			for (idx_t i = 0; i < size; i++) {
+				const auto &c = ptr[i];
+				if (escaped) {
+					escaped = false;
+				} else if (in_string) {
+					escaped = c == '\\';
+					in_string = c != '"';
+				} else if (c == '"') {
+					in_string = true;
+				} else if (c == '\\') {
+					return nullptr;
+				}
+				string_bits |= uint8_t(in_string << i);
+			}
+		}
+
+		// '{' and '[' (and '}' and ']') only differ in bit 0x20
+		const auto lowered = word | BroadcastByte(0x20);
+		uint32_t structural_bits =
+		    MaskToBits(BytesEqualMask(word, ',') | BytesEqualMask(lowered, '{') | BytesEqualMask(lowered, '}'));
+		structural_bits &= uint8_t(~string_bits);
+
+		if (member_count + sizeof(uint64_t) > member_ends.size()) {
+			member_ends.resize(member_ends.size() * 2 + sizeof(uint64_t));
+		}
+		auto member_ends_ptr = member_ends.data();
+		// The structural characters are handled without branches (other than the loop), as they are unpredictable
+		while (structural_bits) {
+			const auto &c = ptr[CountZeros<uint32_t>::Trailing(structural_bits)];
+			structural_bits &= structural_bits - 1;
+			const bool is_open = (c | 0x20) == '{';
+			const bool is_close = (c | 0x20) == '}';
+			const bool is_object = c & 0x20;
+			error |= is_close && (object_bits & 1) != is_object;
+			object_bits = is_open ? (object_bits << 1) | is_object : (is_close ? object_bits >> 1 : object_bits);
+			depth += int64_t(is_open) - int64_t(is_close);
+			member_ends_ptr[member_count] = &c;
+			member_count += depth == 1 ? c == ',' : is_close && depth == 0;
+			if (depth <= 0) {
+				return depth < 0 || error ? nullptr : &c;
+			}
+		}
+		if (depth > int64_t(MAXIMUM_DEPTH)) {
+			return nullptr;
+		}
+	}
+	return nullptr;
+}
+
+bool JSONScanLocalState::ParseProjectedJSON(const char *const json_start, const idx_t json_size) {
+	const char *const end = json_start + json_size;
+	const auto object_start = SkipJSONWhitespace(json_start, end);
+	if (object_start == end || *object_start != '{') {
+		return false;
+	}
+	idx_t member_count;
+	const auto object_end = FindJSONMembers(object_start, end, member_ends, member_count);
+	if (!object_end || SkipJSONWhitespace(object_end + 1, end) != end) {
+		return false;
+	}
+
+	// Copy only the members with a projected key to a new (smaller) object, which is then parsed by yyjson.
+	// The new object is never larger than the record, plus the padding that yyjson needs for in-situ parsing
+	auto alc = allocator.GetYYAlc();
+	auto projected_json = (char *)alc->malloc(alc->ctx, json_size + YYJSON_PADDING_SIZE);
+	idx_t projected_size = 0;
+	projected_json[projected_size++] = '{';
+
+	auto member_start = object_start + 1;
+	for (idx_t member_idx = 0; member_idx < member_count; member_idx++) {
+		const auto member_end = member_ends[member_idx];
+		const auto key_start = SkipJSONWhitespace(member_start, member_end);
+		if (key_start == member_end) {
+			if (member_idx + 1 != member_count) {
+				return false; // Only the last member can be empty, i.e., an empty object or a trailing comma
+			}
+			break;
+		}
+		if (*key_start != '"') {
+			return false;
+		}
+		bool escaped = false;
+		const auto key_end = SkipJSONString(key_start + 1, member_end, escaped);
+		if (!key_end) {
+			return false;
+		}
+		const auto colon = SkipJSONWhitespace(key_end, member_end);
+		if (colon == member_end || *colon != ':' || SkipJSONWhitespace(colon + 1, member_end) == member_end) {
+			return false;
+		}
+
+		// Keys with escape sequences are always copied, we let yyjson unescape and match them
+		const JSONKey key {key_start + 1, size_t(key_end - key_start - 2)};
+		if (escaped || ((projected_key_filter & JSONKeyFilterBit(key.ptr, key.len)) &&
+		                projected_keys.find(key) != projected_keys.end())) {
+			if (projected_size != 1) {
+				projected_json[projected_size++] = ',';
+			}
+			memcpy(projected_json + projected_size, key_start, member_end - key_start);
+			projected_size += member_end - key_start;
+		}
+		member_start = member_end + 1;
+	}
+	projected_json[projected_size++] = '}';
+	memset(projected_json + projected_size, 0, YYJSON_PADDING_SIZE);
+
+	// Malformed values are detected here, the whole record is then parsed again to report the error
+	yyjson_read_err err;
+	auto doc = JSONCommon::ReadDocumentUnsafe(projected_json, projected_size, JSONCommon::READ_INSITU_FLAG, alc, &err);
+	if (err.code != YYJSON_READ_SUCCESS) {
+		return false;
+	}
+
+	lines_or_objects_in_buffer++;
+	units[scan_count] = JSONString(json_start, json_size);
+	TrimWhitespace(units[scan_count]);
+	values[scan_count] = doc->root;
+	return true;
+}
+
 void JSONScanLocalState::ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining) {
+	if (projected_scan && ParseProjectedJSON(json_start, json_size)) {
+		return;
+	}
+	// Parse the whole record, this also reports the error if the record is malformed
 	yyjson_doc *doc;
 	yyjson_read_err err;
 	if (bind_data.type == JSONScanType::READ_JSON_OBJECTS) { // If we return strings, we cannot parse INSITU
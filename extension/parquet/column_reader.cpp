@@ -240,10 +240,16 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	// skips that were not applied in the previous row group no longer matter
+	pending_skips = 0;
+	page_rows_available = 0;
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
 	dict_decoder.reset();
+	dbp_decoder.reset();
+	rle_decoder.reset();
+	byte_array_data.reset();
 	defined_decoder.reset();
 	block.reset();
 	PageHeader page_hdr;
@@ -445,6 +451,39 @@ void ColumnReader::PrepareDataPage(PageHeader &page_hdr) {
 		PrepareDeltaByteArray(*block);
 		break;
 	}
+	case Encoding::BYTE_STREAM_SPLIT: {
+		// the k-th bytes of all values are stored consecutively, restore the plain encoding so it can be read below
+		idx_t value_width;
+		switch (Schema().type) {
+		case Type::FLOAT:
+		case Type::INT32:
+			value_width = sizeof(uint32_t);
+			break;
+		case Type::DOUBLE:
+		case Type::INT64:
+			value_width = sizeof(uint64_t);
+			break;
+		case Type::FIXED_LEN_BYTE_ARRAY:
+			value_width = Schema().type_length;
+			break;
+		default:
+			throw std::runtime_error("BYTE_STREAM_SPLIT is not supported for this type");
+		}
+		if (value_width == 0) {
+			throw std::runtime_error("BYTE_STREAM_SPLIT requires a type length - corrupt file?");
+		}
+		// the block is padded (see PreparePage), the padding is smaller than a value (or irrelevant for 1-byte values)
+		auto value_count = block->len / value_width;
+		auto plain_block = make_shared<ResizeableBuffer>(reader.allocator, block->len);
+		for (idx_t byte_idx = 0; byte_idx < value_width; byte_idx++) {
+			auto stream = block->ptr + byte_idx * value_count;
+			for (idx_t value_idx = 0; value_idx < value_count; value_idx++) {
+				plain_block->ptr[value_idx * value_width + byte_idx] = stream[value_idx];
+			}
+		}
+		block = std::move(plain_block);
+		break;
+	}
 	case Encoding::PLAIN:
 		// nothing to do here, will be read directly below
 		break;
@@ -509,13 +548,14 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 			// TODO keep this in the state
 			auto read_buf = make_shared<ResizeableBuffer>();
 
-			switch (type.InternalType()) {
-			case PhysicalType::INT32:
+			// the values are decoded in their physical type, Plain() converts them to the type of the column
+			switch (Schema().type) {
+			case Type::INT32:
 				read_buf->resize(reader.allocator, sizeof(int32_t) * (read_now - null_count));
 				dbp_decoder->GetBatch<int32_t>(read_buf->ptr, read_now - null_count);
 
 				break;
-			case PhysicalType::INT64:
+			case Type::INT64:
 				read_buf->resize(reader.allocator, sizeof(int64_t) * (read_now - null_count));
 				dbp_decoder->GetBatch<int64_t>(read_buf->ptr, read_now - null_count);
 				break;
@@ -555,6 +595,44 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (HasRepeats()) {
+		// pages of repeated columns do not necessarily start at a row boundary
+		return 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.SetLocation(chunk_read_offset);
+
+	idx_t skipped = 0;
+	while (page_rows_available == 0 && skipped < num_values && group_rows_available > 0) {
+		auto page_start = trans.GetLocation();
+		PageHeader page_hdr;
+		page_hdr.read(protocol);
+		if (page_hdr.type == PageType::DICTIONARY_PAGE) {
+			// the dictionary is required for reading the subsequent pages
+			trans.SetLocation(page_start);
+			PrepareRead(none_filter);
+			continue;
+		}
+		idx_t page_rows = 0;
+		if (page_hdr.type == PageType::DATA_PAGE && page_hdr.__isset.data_page_header) {
+			page_rows = page_hdr.data_page_header.num_values;
+		} else if (page_hdr.type == PageType::DATA_PAGE_V2 && page_hdr.__isset.data_page_header_v2) {
+			page_rows = page_hdr.data_page_header_v2.num_values;
+		}
+		if (page_rows == 0 || skipped + page_rows > num_values) {
+			// we need (part of) this page: rewind so it is read normally
+			trans.SetLocation(page_start);
+			break;
+		}
+		trans.SetLocation(trans.GetLocation() + page_hdr.compressed_page_size);
+		skipped += page_rows;
+		group_rows_available -= page_rows;
+	}
+	chunk_read_offset = trans.GetLocation();
+	return skipped;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
@@ -568,7 +646,20 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	idx_t read = 0;
 
 	while (remaining) {
+		if (page_rows_available == 0) {
+			// we are at a page boundary: skip over entire pages without decompressing them
+			auto skipped = SkipPages(remaining);
+			read += skipped;
+			remaining -= skipped;
+			if (remaining == 0) {
+				break;
+			}
+		}
 		idx_t to_read = MinValue<idx_t>(remaining, STANDARD_VECTOR_SIZE);
+		if (page_rows_available > 0) {
+			// only decode the remainder of the current page, so we can skip the following pages
+			to_read = MinValue<idx_t>(to_read, page_rows_available);
+		}
 		read += Read(to_read, none_filter, dummy_define.ptr, dummy_repeat.ptr, dummy_result);
 		remaining -= to_read;
 	}
@@ -1,10 +1,13 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
+#include "parquet_dbp_encoder.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -83,6 +86,13 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+bool ColumnWriterStatistics::HasStats() {
+	return false;
+}
+
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -175,7 +185,7 @@ void RleBpEncoder::FinishWrite(Serializer &writer) {
 ColumnWriter::ColumnWriter(ParquetWriter &writer, idx_t schema_idx, vector<string> schema_path_p, idx_t max_repeat,
                            idx_t max_define, bool can_have_nulls)
     : writer(writer), schema_idx(schema_idx), schema_path(std::move(schema_path_p)), max_repeat(max_repeat),
-      max_define(max_define), can_have_nulls(can_have_nulls), null_count(0) {
+      max_define(max_define), can_have_nulls(can_have_nulls), bloom_filter_fpp(0) {
 }
 ColumnWriter::~ColumnWriter() {
 }
@@ -253,7 +263,7 @@ void ColumnWriter::HandleDefineLevels(ColumnWriterState &state, ColumnWriterStat
 				if (!can_have_nulls) {
 					throw IOException("Parquet writer: map key column is not allowed to contain NULL values");
 				}
-				null_count++;
+				state.null_count++;
 				state.definition_levels.push_back(null_value);
 			}
 			if (parent->is_empty.empty() || !parent->is_empty[current_index]) {
@@ -269,7 +279,7 @@ void ColumnWriter::HandleDefineLevels(ColumnWriterState &state, ColumnWriterStat
 				if (!can_have_nulls) {
 					throw IOException("Parquet writer: map key column is not allowed to contain NULL values");
 				}
-				null_count++;
+				state.null_count++;
 				state.definition_levels.push_back(null_value);
 			}
 		}
@@ -305,6 +315,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	duckdb::unique_ptr<BufferedSerializer> temp_writer;
 	duckdb::unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of this page, only gathered for non-repeated columns (for the page index)
+	duckdb::unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -327,6 +339,11 @@ public:
 	vector<PageWriteInformation> write_info;
 	duckdb::unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! The hashes of the values that are inserted into the Bloom filter of the column chunk
+	vector<uint64_t> bloom_filter_hashes;
+	//! The Bloom filter and the column index of the column chunk, created by FinishWrite
+	duckdb::unique_ptr<ParquetBloomFilter> bloom_filter;
+	duckdb::unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
 };
 
 //===--------------------------------------------------------------------===//
@@ -345,6 +362,8 @@ public:
 	//! We limit the uncompressed page size to 100MB
 	// The max size in Parquet is 2GB, but we choose a more conservative limit
 	static constexpr const idx_t MAX_UNCOMPRESSED_PAGE_SIZE = 100000000;
+	//! Non-repeated columns are split into pages of roughly 1MB, so readers can skip pages using the page index
+	static constexpr const idx_t TARGET_UNCOMPRESSED_PAGE_SIZE = 1000000;
 	//! Dictionary pages must be below 2GB. Unlike data pages, there's only one dictionary page.
 	//  For this reason we go with a much higher, but still a conservative upper bound of 1GB;
 	static constexpr const idx_t MAX_UNCOMPRESSED_DICT_PAGE_SIZE = 1e9;
@@ -354,12 +373,19 @@ public:
 	// the size of encoding the string length
 	static constexpr const idx_t STRING_LENGTH_SIZE = sizeof(uint32_t);
 
+	//! Whether a delta encoding of (an estimated) "delta_size" bytes is preferred over a plain encoding of
+	//! "plain_size" bytes. Delta encodings are slower to decode, so they have to save at least a quarter of the size.
+	static bool PreferDeltaEncoding(idx_t delta_size, idx_t plain_size) {
+		return delta_size * 4 < plain_size * 3;
+	}
+
 public:
 	duckdb::unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group,
 	                                                           Allocator &allocator) override;
 	void Prepare(ColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) override;
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinishWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 
 protected:
@@ -385,6 +411,8 @@ protected:
 	//! Writes a (subset of a) vector to the specified serializer. Only used for scalar types.
 	virtual void WriteVector(Serializer &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
+	//! Appends the Bloom filter hashes of the (non-null) values of a vector. Only used for scalar types.
+	virtual void HashValues(Vector &input_column, idx_t count, vector<uint64_t> &hashes);
 
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
@@ -396,6 +424,10 @@ protected:
 	virtual void FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats);
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
+	//! Creates the Bloom filter of the column chunk, or returns nullptr if no Bloom filter is written for the column
+	duckdb::unique_ptr<ParquetBloomFilter> CreateBloomFilter(BasicColumnWriterState &state);
+	//! Creates the column index of the page index, or returns nullptr if statistics are missing for any of the pages
+	duckdb::unique_ptr<duckdb_parquet::format::ColumnIndex> CreateColumnIndex(BasicColumnWriterState &state);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
 };
 
@@ -434,6 +466,7 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 	HandleRepeatLevels(state, parent, count, max_repeat);
 	HandleDefineLevels(state, parent, validity, count, max_define, max_define - 1);
 
+	auto max_page_size = max_repeat == 0 ? TARGET_UNCOMPRESSED_PAGE_SIZE : MAX_UNCOMPRESSED_PAGE_SIZE;
 	idx_t vector_index = 0;
 	for (idx_t i = start; i < vcount; i++) {
 		auto &page_info = state.page_info.back();
@@ -445,7 +478,7 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
+			if (page_info.estimated_page_size >= max_page_size) {
 				PageInformation new_info;
 				new_info.offset = page_info.offset + page_info.row_count;
 				state.page_info.push_back(new_info);
@@ -488,6 +521,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		if (max_repeat == 0) {
+			write_info.page_stats = InitializeStatsState();
+		}
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -558,6 +594,9 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	if (write_info.page_stats) {
+		state.stats_state->Merge(*write_info.page_stats);
+	}
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.blob.size > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -587,8 +626,15 @@ idx_t BasicColumnWriter::GetRowSize(Vector &vector, idx_t index, BasicColumnWrit
 	throw InternalException("GetRowSize unsupported for struct/list column writers");
 }
 
+void BasicColumnWriter::HashValues(Vector &input_column, idx_t count, vector<uint64_t> &hashes) {
+	throw InternalException("Bloom filters are not supported for this column writer");
+}
+
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
+	if (bloom_filter_fpp > 0) {
+		HashValues(vector, count, state.bloom_filter_hashes);
+	}
 
 	idx_t remaining = count;
 	idx_t offset = 0;
@@ -601,8 +647,8 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		auto stats = write_info.page_stats ? write_info.page_stats.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -616,7 +662,7 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
                                              duckdb_parquet::format::ColumnChunk &column_chunk) {
 	if (max_repeat == 0) {
-		column_chunk.meta_data.statistics.null_count = null_count;
+		column_chunk.meta_data.statistics.null_count = state.null_count;
 		column_chunk.meta_data.statistics.__isset.null_count = true;
 		column_chunk.meta_data.__isset.statistics = true;
 	}
@@ -651,32 +697,47 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 	}
 }
 
-void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void BasicColumnWriter::FinishWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
 	auto &column_chunk = state.row_group.columns[state.col_idx];
 
 	// flush the last page (if any remains)
 	FlushPage(state);
 
-	auto &column_writer = writer.GetWriter();
-	auto start_offset = column_writer.GetTotalWritten();
-	auto page_offset = start_offset;
 	// flush the dictionary
 	if (HasDictionary(state)) {
 		column_chunk.meta_data.statistics.distinct_count = DictionarySize(state);
 		column_chunk.meta_data.statistics.__isset.distinct_count = true;
+		FlushDictionary(state, state.stats_state.get());
+	}
+	SetParquetStatistics(state, column_chunk);
+
+	state.bloom_filter = CreateBloomFilter(state);
+	if (max_repeat == 0) {
+		// rows of repeated columns can span multiple pages, so we only write the page index for non-repeated columns
+		state.column_index = CreateColumnIndex(state);
+	}
+}
+
+void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<BasicColumnWriterState>();
+	auto &column_chunk = state.row_group.columns[state.col_idx];
+
+	auto &column_writer = writer.GetWriter();
+	auto start_offset = column_writer.GetTotalWritten();
+	auto page_offset = start_offset;
+	if (HasDictionary(state)) {
 		column_chunk.meta_data.dictionary_page_offset = page_offset;
 		column_chunk.meta_data.__isset.dictionary_page_offset = true;
-		FlushDictionary(state, state.stats_state.get());
 		page_offset += state.write_info[0].compressed_size;
 	}
 
 	// record the start position of the pages for this column
 	column_chunk.meta_data.data_page_offset = page_offset;
-	SetParquetStatistics(state, column_chunk);
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	duckdb_parquet::format::OffsetIndex offset_index;
 	for (auto &write_info : state.write_info) {
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
 		auto header_start_offset = column_writer.GetTotalWritten();
@@ -685,9 +746,75 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		column_writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (write_info.page_header.type == PageType::DICTIONARY_PAGE) {
+			continue;
+		}
+		// the page location includes the page header
+		duckdb_parquet::format::PageLocation page_location;
+		page_location.offset = header_start_offset;
+		page_location.compressed_page_size = column_writer.GetTotalWritten() - header_start_offset;
+		page_location.first_row_index = state.page_info[offset_index.page_locations.size()].offset;
+		offset_index.page_locations.push_back(page_location);
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	// the Bloom filter is written right after the pages of the column chunk
+	if (state.bloom_filter) {
+		column_chunk.meta_data.bloom_filter_offset = column_writer.GetTotalWritten();
+		column_chunk.meta_data.__isset.bloom_filter_offset = true;
+		state.bloom_filter->Write(*writer.GetProtocol(), column_writer);
+	}
+
+	if (max_repeat == 0) {
+		writer.RegisterPageIndex(state.col_idx, std::move(state.column_index), std::move(offset_index));
+	}
+}
+
+unique_ptr<ParquetBloomFilter> BasicColumnWriter::CreateBloomFilter(BasicColumnWriterState &state) {
+	if (bloom_filter_fpp <= 0) {
+		return nullptr;
+	}
+	// size the filter for the number of distinct values in the column chunk
+	auto &hashes = state.bloom_filter_hashes;
+	std::sort(hashes.begin(), hashes.end());
+	hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+	auto num_bytes = ParquetBloomFilter::OptimalNumBytes(hashes.size(), bloom_filter_fpp);
+	auto bloom_filter = make_uniq<ParquetBloomFilter>(num_bytes);
+	for (auto &hash : hashes) {
+		bloom_filter->InsertHash(hash);
+	}
+	hashes.clear();
+	return bloom_filter;
+}
+
+unique_ptr<duckdb_parquet::format::ColumnIndex> BasicColumnWriter::CreateColumnIndex(BasicColumnWriterState &state) {
+	auto column_index = make_uniq<duckdb_parquet::format::ColumnIndex>();
+	column_index->boundary_order = duckdb_parquet::format::BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	idx_t page_idx = 0;
+	for (auto &write_info : state.write_info) {
+		if (write_info.page_header.type == PageType::DICTIONARY_PAGE) {
+			continue;
+		}
+		auto &page_info = state.page_info[page_idx++];
+		idx_t page_null_count = 0;
+		for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+			if (i < state.definition_levels.size() && state.definition_levels[i] != max_define) {
+				page_null_count++;
+			}
+		}
+		bool null_page = page_null_count == page_info.row_count;
+		if (!null_page && !write_info.page_stats->HasStats()) {
+			// no statistics for this page (e.g., because the type has no statistics): we cannot write a column index
+			return nullptr;
+		}
+		column_index->null_pages.push_back(null_page);
+		column_index->min_values.push_back(null_page ? string() : write_info.page_stats->GetMinValue());
+		column_index->max_values.push_back(null_page ? string() : write_info.page_stats->GetMaxValue());
+		column_index->null_counts.push_back(page_null_count);
+	}
+	return column_index;
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -741,10 +868,20 @@ public:
 	T max;
 
 public:
-	bool HasStats() {
+	bool HasStats() override {
 		return min <= max;
 	}
 
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
+
 	string GetMin() override {
 		return NumericLimits<SRC>::IsSigned() ? GetMinValue() : string();
 	}
@@ -827,6 +964,38 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, idx_
 	}
 }
 
+class StandardColumnWriterState : public BasicColumnWriterState {
+public:
+	StandardColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx)
+	    : BasicColumnWriterState(row_group, col_idx) {
+	}
+	~StandardColumnWriterState() override = default;
+
+	// analysis state
+	duckdb::unique_ptr<DbpEncoder> delta_size_estimator;
+	idx_t estimated_plain_size = 0;
+
+	//! The encoding of the data pages: PLAIN, DELTA_BINARY_PACKED or BYTE_STREAM_SPLIT
+	Encoding::type encoding = Encoding::PLAIN;
+};
+
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	StandardWriterPageState(Encoding::type encoding, idx_t value_width) : encoding(encoding) {
+		if (encoding == Encoding::DELTA_BINARY_PACKED) {
+			dbp_encoder = make_uniq<DbpEncoder>(value_width);
+		} else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+			plain_data = make_uniq<BufferedSerializer>();
+		}
+	}
+
+	Encoding::type encoding;
+	//! The encoder of a DELTA_BINARY_PACKED page
+	duckdb::unique_ptr<DbpEncoder> dbp_encoder;
+	//! The plain values of a BYTE_STREAM_SPLIT page, which are split into streams when the page is flushed
+	duckdb::unique_ptr<BufferedSerializer> plain_data;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
 public:
@@ -836,15 +1005,118 @@ public:
 	}
 	~StandardColumnWriter() override = default;
 
+	//! 32 and 64-bit integers (including dates, times and timestamps) can be written using DELTA_BINARY_PACKED
+	static constexpr const bool SUPPORTS_DELTA_ENCODING =
+	    std::is_integral<TGT>::value && (sizeof(TGT) == sizeof(int32_t) || sizeof(TGT) == sizeof(int64_t));
+
 public:
 	duckdb::unique_ptr<ColumnWriterStatistics> InitializeStatsState() override {
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
-	void WriteVector(Serializer &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
+	duckdb::unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group,
+	                                                           Allocator &allocator) override {
+		auto result = make_uniq<StandardColumnWriterState>(row_group, row_group.columns.size());
+		if (writer.GetParquetVersion() == ParquetVersion::V1) {
+			// only PLAIN is supported by all readers
+		} else if (SUPPORTS_DELTA_ENCODING) {
+			result->delta_size_estimator = make_uniq<DbpEncoder>(sizeof(TGT), true);
+		} else if (std::is_floating_point<TGT>::value && writer.GetCodec() != CompressionCodec::UNCOMPRESSED) {
+			// splitting the bytes of floating point values into separate streams makes them compress better
+			result->encoding = Encoding::BYTE_STREAM_SPLIT;
+		}
+		RegisterToRowGroup(row_group);
+		return std::move(result);
+	}
+
+	bool HasAnalyze() override {
+		return SUPPORTS_DELTA_ENCODING && writer.GetParquetVersion() != ParquetVersion::V1;
+	}
+
+	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		auto &mask = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<SRC>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				state.delta_size_estimator->WriteValue(int64_t(OP::template Operation<SRC, TGT>(ptr[r])));
+				state.estimated_plain_size += sizeof(TGT);
+			}
+		}
+	}
+
+	void FinalizeAnalyze(ColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		if (PreferDeltaEncoding(state.delta_size_estimator->GetByteCount(), state.estimated_plain_size)) {
+			state.encoding = Encoding::DELTA_BINARY_PACKED;
+		}
+		state.delta_size_estimator.reset();
+	}
+
+	void WriteVector(Serializer &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state_p,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
+		auto &page_state = page_state_p->Cast<StandardWriterPageState>();
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		switch (page_state.encoding) {
+		case Encoding::DELTA_BINARY_PACKED: {
+			auto *ptr = FlatVector::GetData<SRC>(input_column);
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (mask.RowIsValid(r)) {
+					TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+					OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+					page_state.dbp_encoder->WriteValue(int64_t(target_value));
+				}
+			}
+			break;
+		}
+		case Encoding::BYTE_STREAM_SPLIT:
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask,
+			                                  *page_state.plain_data);
+			break;
+		default:
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			break;
+		}
+	}
+
+	duckdb::unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		return make_uniq<StandardWriterPageState>(state.encoding, sizeof(TGT));
+	}
+
+	void FlushPageState(Serializer &temp_writer, ColumnWriterPageState *state_p) override {
+		auto &page_state = state_p->Cast<StandardWriterPageState>();
+		if (page_state.encoding == Encoding::DELTA_BINARY_PACKED) {
+			page_state.dbp_encoder->FinishWrite(temp_writer);
+		} else if (page_state.encoding == Encoding::BYTE_STREAM_SPLIT) {
+			// split the values into one stream per byte position
+			auto &plain_data = page_state.plain_data->blob;
+			auto plain_values = plain_data.data.get();
+			auto value_count = plain_data.size / sizeof(TGT);
+			auto split_data = unique_ptr<data_t[]>(new data_t[plain_data.size]);
+			for (idx_t byte_idx = 0; byte_idx < sizeof(TGT); byte_idx++) {
+				for (idx_t value_idx = 0; value_idx < value_count; value_idx++) {
+					split_data[byte_idx * value_count + value_idx] = plain_values[value_idx * sizeof(TGT) + byte_idx];
+				}
+			}
+			temp_writer.WriteData(split_data.get(), plain_data.size);
+		}
+	}
+
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		return state.encoding;
+	}
+
+	void HashValues(Vector &input_column, idx_t count, vector<uint64_t> &hashes) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				hashes.push_back(ParquetBloomFilter::Hash(const_data_ptr_cast(&target_value), sizeof(TGT)));
+			}
+		}
 	}
 
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
@@ -864,10 +1136,16 @@ public:
 	bool max;
 
 public:
-	bool HasStats() {
+	bool HasStats() override {
 		return !(min && !max);
 	}
 
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
+
 	string GetMin() override {
 		return GetMinValue();
 	}
@@ -986,7 +1264,7 @@ public:
 		return string(const_char_ptr_cast(buffer), 16);
 	}
 
-	bool HasStats() {
+	bool HasStats() override {
 		return min <= max;
 	}
 
@@ -999,6 +1277,14 @@ public:
 		}
 	}
 
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
+
 	string GetMin() override {
 		return GetMinValue();
 	}
@@ -1042,6 +1328,19 @@ public:
 		}
 	}
 
+	void HashValues(Vector &input_column, idx_t count, vector<uint64_t> &hashes) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<hugeint_t>(input_column);
+
+		data_t temp_buffer[16];
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				WriteParquetDecimal(ptr[r], temp_buffer);
+				hashes.push_back(ParquetBloomFilter::Hash(temp_buffer, 16));
+			}
+		}
+	}
+
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return sizeof(hugeint_t);
 	}
@@ -1089,6 +1388,19 @@ public:
 		}
 	}
 
+	void HashValues(Vector &input_column, idx_t count, vector<uint64_t> &hashes) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<hugeint_t>(input_column);
+
+		data_t temp_buffer[PARQUET_UUID_SIZE];
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				WriteParquetUUID(ptr[r], temp_buffer);
+				hashes.push_back(ParquetBloomFilter::Hash(temp_buffer, PARQUET_UUID_SIZE));
+			}
+		}
+	}
+
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return PARQUET_UUID_SIZE;
 	}
@@ -1152,8 +1464,8 @@ public:
 	string max;
 
 public:
-	bool HasStats() {
-		return has_stats;
+	bool HasStats() override {
+		return has_stats && !values_too_big;
 	}
 
 	void Update(const string_t &val) {
@@ -1180,6 +1492,20 @@ public:
 		has_stats = true;
 	}
 
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.HasStats()) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
+
 	string GetMin() override {
 		return GetMinValue();
 	}
@@ -1196,8 +1522,13 @@ public:
 
 class StringColumnWriterState : public BasicColumnWriterState {
 public:
-	StringColumnWriterState(duckdb_parquet::format::RowGroup &row_group, Allocator &allocator, idx_t col_idx)
+	StringColumnWriterState(duckdb_parquet::format::RowGroup &row_group, Allocator &allocator, idx_t col_idx,
+	                        bool estimate_delta_size)
 	    : BasicColumnWriterState(row_group, col_idx), dictionary_heap(allocator) {
+		if (estimate_delta_size) {
+			prefix_length_estimator = make_uniq<DbpEncoder>(sizeof(uint32_t), true);
+			suffix_length_estimator = make_uniq<DbpEncoder>(sizeof(uint32_t), true);
+		}
 	}
 	~StringColumnWriterState() override = default;
 
@@ -1205,6 +1536,12 @@ public:
 	idx_t estimated_dict_page_size = 0;
 	idx_t estimated_rle_pages_size = 0;
 	idx_t estimated_plain_size = 0;
+	// the DELTA_BYTE_ARRAY estimate consists of the encoded prefix and suffix lengths and the suffixes
+	// (only if the DELTA_BYTE_ARRAY encoding can be used)
+	duckdb::unique_ptr<DbpEncoder> prefix_length_estimator;
+	duckdb::unique_ptr<DbpEncoder> suffix_length_estimator;
+	idx_t estimated_suffix_size = 0;
+	string previous_value;
 
 	// Dictionary and accompanying string heap
 	string_map_t<uint32_t> dictionary;
@@ -1212,26 +1549,55 @@ public:
 	// key_bit_width== 0 signifies the chunk is written in plain encoding
 	uint32_t key_bit_width;
 
+	// if the chunk is not dictionary encoded, it can be written using the DELTA_BYTE_ARRAY encoding
+	bool delta_encoded = false;
+
 	bool IsDictionaryEncoded() {
 		return key_bit_width != 0;
 	}
 };
 
+//! Returns the length of the prefix that a value shares with the previous value
+static idx_t CommonPrefixLength(const string &previous_value, const string_t &value) {
+	auto max_length = MinValue<idx_t>(previous_value.size(), value.GetSize());
+	auto data = value.GetData();
+	idx_t length = 0;
+	while (length < max_length && previous_value[length] == data[length]) {
+		length++;
+	}
+	return length;
+}
+
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
+	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values, bool delta_encoded)
 	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
+		D_ASSERT(!IsDictionaryEncoded() || !delta_encoded);
+		if (delta_encoded) {
+			prefix_lengths = make_uniq<DbpEncoder>(sizeof(uint32_t));
+			suffix_lengths = make_uniq<DbpEncoder>(sizeof(uint32_t));
+			suffixes = make_uniq<BufferedSerializer>();
+		}
 	}
 
 	bool IsDictionaryEncoded() {
 		return bit_width != 0;
 	}
-	// if 0, we're writing a plain page
+	bool IsDeltaEncoded() {
+		return prefix_lengths != nullptr;
+	}
+	// if 0, we're writing a plain or delta page
 	uint32_t bit_width;
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+
+	// the DELTA_BYTE_ARRAY encoding writes the prefix lengths, followed by the suffix lengths and the suffixes
+	duckdb::unique_ptr<DbpEncoder> prefix_lengths;
+	duckdb::unique_ptr<DbpEncoder> suffix_lengths;
+	duckdb::unique_ptr<BufferedSerializer> suffixes;
+	string previous_value;
 };
 
 class StringColumnWriter : public BasicColumnWriter {
@@ -1249,7 +1615,8 @@ public:
 
 	duckdb::unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group,
 	                                                           Allocator &allocator) override {
-		auto result = make_uniq<StringColumnWriterState>(row_group, allocator, row_group.columns.size());
+		auto result = make_uniq<StringColumnWriterState>(row_group, allocator, row_group.columns.size(),
+		                                                 writer.GetParquetVersion() != ParquetVersion::V1);
 		RegisterToRowGroup(row_group);
 		return std::move(result);
 	}
@@ -1285,6 +1652,13 @@ public:
 				                       state.dictionary_heap.AddBlob(value), new_value_index))
 				                 : state.dictionary.insert(string_map_t<uint32_t>::value_type(value, new_value_index));
 				state.estimated_plain_size += value.GetSize() + STRING_LENGTH_SIZE;
+				if (state.prefix_length_estimator) {
+					auto prefix_length = CommonPrefixLength(state.previous_value, value);
+					state.prefix_length_estimator->WriteValue(prefix_length);
+					state.suffix_length_estimator->WriteValue(value.GetSize() - prefix_length);
+					state.estimated_suffix_size += value.GetSize() - prefix_length;
+					state.previous_value.assign(value.GetData(), value.GetSize());
+				}
 				if (found.second) {
 					// string didn't exist yet in the dictionary
 					new_value_index++;
@@ -1313,12 +1687,21 @@ public:
 		// be too large
 		if (state.estimated_dict_page_size > MAX_UNCOMPRESSED_DICT_PAGE_SIZE ||
 		    state.estimated_rle_pages_size + state.estimated_dict_page_size > state.estimated_plain_size) {
-			// clearing the dictionary signals a plain write
+			// clearing the dictionary signals a plain (or delta) write
 			state.dictionary.clear();
 			state.key_bit_width = 0;
+			if (state.prefix_length_estimator) {
+				auto estimated_delta_size = state.prefix_length_estimator->GetByteCount() +
+				                            state.suffix_length_estimator->GetByteCount() +
+				                            state.estimated_suffix_size;
+				state.delta_encoded = PreferDeltaEncoding(estimated_delta_size, state.estimated_plain_size);
+			}
 		} else {
 			state.key_bit_width = RleBpDecoder::ComputeBitWidth(state.dictionary.size());
 		}
+		state.prefix_length_estimator.reset();
+		state.suffix_length_estimator.reset();
+		state.previous_value = string();
 	}
 
 	void WriteVector(Serializer &temp_writer, ColumnWriterStatistics *stats_p, ColumnWriterPageState *page_state_p,
@@ -1335,6 +1718,8 @@ public:
 					continue;
 				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
+				// the chunk statistics are also gathered from the dictionary, but the page index needs page statistics
+				stats.Update(ptr[r]);
 				if (!page_state.written_value) {
 					// first value
 					// write the bit-width as a one-byte entry
@@ -1346,6 +1731,20 @@ public:
 					page_state.encoder.WriteValue(temp_writer, value_index);
 				}
 			}
+		} else if (page_state.IsDeltaEncoded()) {
+			// delta page, the values are written when the page is flushed
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				stats.Update(ptr[r]);
+				auto prefix_length = CommonPrefixLength(page_state.previous_value, ptr[r]);
+				auto suffix_length = ptr[r].GetSize() - prefix_length;
+				page_state.prefix_lengths->WriteValue(prefix_length);
+				page_state.suffix_lengths->WriteValue(suffix_length);
+				page_state.suffixes->WriteData(const_data_ptr_cast(ptr[r].GetData()) + prefix_length, suffix_length);
+				page_state.previous_value.assign(ptr[r].GetData(), ptr[r].GetSize());
+			}
 		} else {
 			// plain page
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
@@ -1359,9 +1758,19 @@ public:
 		}
 	}
 
+	void HashValues(Vector &input_column, idx_t count, vector<uint64_t> &hashes) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				hashes.push_back(ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
+	}
+
 	duckdb::unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, state.delta_encoded);
 	}
 
 	void FlushPageState(Serializer &temp_writer, ColumnWriterPageState *state_p) override {
@@ -1374,12 +1783,20 @@ public:
 				return;
 			}
 			page_state.encoder.FinishWrite(temp_writer);
+		} else if (page_state.IsDeltaEncoded()) {
+			page_state.prefix_lengths->FinishWrite(temp_writer);
+			page_state.suffix_lengths->FinishWrite(temp_writer);
+			auto &suffixes = page_state.suffixes->blob;
+			temp_writer.WriteData(suffixes.data.get(), suffixes.size);
 		}
 	}
 
 	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+		if (state.IsDictionaryEncoded()) {
+			return Encoding::RLE_DICTIONARY;
+		}
+		return state.delta_encoded ? Encoding::DELTA_BYTE_ARRAY : Encoding::PLAIN;
 	}
 
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
@@ -1575,6 +1992,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinishWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1665,11 +2083,18 @@ void StructColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 	}
 }
 
-void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void StructColumnWriter::FinishWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<StructColumnWriterState>();
 	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
 		// we add the null count of the struct to the null count of the children
-		child_writers[child_idx]->null_count += null_count;
+		state.child_states[child_idx]->null_count += state.null_count;
+		child_writers[child_idx]->FinishWrite(*state.child_states[child_idx]);
+	}
+}
+
+void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<StructColumnWriterState>();
+	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
 		child_writers[child_idx]->FinalizeWrite(*state.child_states[child_idx]);
 	}
 }
@@ -1698,6 +2123,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinishWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1807,6 +2233,11 @@ void ListColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t c
 	child_writer->Write(*state.child_state, child_list, child_length);
 }
 
+void ListColumnWriter::FinishWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<ListColumnWriterState>();
+	child_writer->FinishWrite(*state.child_state);
+}
+
 void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<ListColumnWriterState>();
 	child_writer->FinalizeWrite(*state.child_state);
@@ -111,6 +111,8 @@ protected:
 
 	// applies any skips that were registered using Skip()
 	virtual void ApplyPendingSkips(idx_t num_values);
+	// skips over entire data pages (at most num_values rows) without decompressing them, returns the skipped row count
+	idx_t SkipPages(idx_t num_values);
 
 	bool HasDefines() {
 		return max_define > 0;
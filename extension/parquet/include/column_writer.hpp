@@ -24,6 +24,8 @@ public:
 	vector<uint16_t> definition_levels;
 	vector<uint16_t> repetition_levels;
 	vector<bool> is_empty;
+	//! The number of NULL values in the row group
+	idx_t null_count = 0;
 
 public:
 	template <class TARGET>
@@ -46,6 +48,10 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Whether or not any (non-null) values have been gathered
+	virtual bool HasStats();
+	//! Merge the statistics of a page into the statistics of the column chunk
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
@@ -73,8 +79,8 @@ public:
 	idx_t max_repeat;
 	idx_t max_define;
 	bool can_have_nulls;
-	// collected stats
-	idx_t null_count;
+	//! The false positive probability of the Bloom filters written for this column (0 if none are written)
+	double bloom_filter_fpp;
 
 public:
 	//! Create the column writer for a specific type recursively
@@ -104,6 +110,10 @@ public:
 
 	virtual void BeginWrite(ColumnWriterState &state) = 0;
 	virtual void Write(ColumnWriterState &state, Vector &vector, idx_t count) = 0;
+	//! Called after all data has been passed to Write, compresses the remaining pages and computes the metadata of
+	//! the column chunk. Unlike FinalizeWrite, this does not touch the file, so row groups can be finished in parallel.
+	virtual void FinishWrite(ColumnWriterState &state) = 0;
+	//! Appends the (finished) column chunk to the file
 	virtual void FinalizeWrite(ColumnWriterState &state) = 0;
 
 protected:
@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/value.hpp"
+#endif
+#include "parquet_types.h"
+#include "thrift/protocol/TProtocol.h"
+
+namespace duckdb {
+class Serializer;
+
+//! A split block Bloom filter, as described in the Parquet specification. The filter consists of blocks of 256 bits,
+//! the upper 32 bits of the (XXH64) hash of a value select the block and the lower 32 bits select one bit in each of
+//! the eight 32-bit words of the block.
+class ParquetBloomFilter {
+public:
+	static constexpr const idx_t BYTES_PER_BLOCK = 32;
+	static constexpr const idx_t MINIMUM_BYTES = BYTES_PER_BLOCK;
+	static constexpr const idx_t MAXIMUM_BYTES = 128 * 1024 * 1024;
+
+	explicit ParquetBloomFilter(idx_t num_bytes);
+
+public:
+	//! Returns the number of bytes for a filter with "distinct_count" values and a false positive rate of "fpp"
+	static idx_t OptimalNumBytes(idx_t distinct_count, double fpp);
+	//! Hashes a value as it is stored in the Parquet file (i.e., its plain encoding without the length prefix)
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+
+	void InsertHash(uint64_t hash);
+	bool FindHash(uint64_t hash) const;
+
+	//! Writes the header and the bitset of the filter
+	void Write(duckdb_apache::thrift::protocol::TProtocol &protocol, Serializer &writer) const;
+	//! Reads a filter, returns nullptr if the filter uses an unsupported algorithm, hash or compression
+	static unique_ptr<ParquetBloomFilter> Read(duckdb_apache::thrift::protocol::TProtocol &protocol);
+
+	//! Hashes a constant the way a column with the given physical type stores it. Returns false if the hash of the
+	//! constant cannot be computed.
+	static bool HashConstant(const Value &constant, duckdb_parquet::format::Type::type physical_type, uint64_t &result);
+
+private:
+	idx_t num_blocks;
+	unique_ptr<uint32_t[]> blocks;
+};
+
+} // namespace duckdb
@@ -0,0 +1,180 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "decode_utils.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/buffered_serializer.hpp"
+#endif
+
+namespace duckdb {
+//! Encodes INT32 or INT64 values using the DELTA_BINARY_PACKED encoding
+class DbpEncoder {
+public:
+	static constexpr const idx_t BLOCK_SIZE_IN_VALUES = 128;
+	static constexpr const idx_t NUMBER_OF_MINIBLOCKS = 4;
+	static constexpr const idx_t VALUES_PER_MINIBLOCK = BLOCK_SIZE_IN_VALUES / NUMBER_OF_MINIBLOCKS;
+
+	//! "value_width" is the width (in bytes) of the physical type, the deltas wrap around at this width.
+	//! If "count_only" is set, the encoded blocks are only counted and not kept (e.g., to estimate the encoded size).
+	DbpEncoder(idx_t value_width, bool count_only = false)
+	    : value_width(value_width), count_only(count_only), total_value_count(0), first_value(0), previous_value(0),
+	      delta_count(0), block_byte_count(0) {
+		D_ASSERT(value_width == sizeof(int32_t) || value_width == sizeof(int64_t));
+	}
+
+public:
+	void WriteValue(int64_t value) {
+		if (total_value_count == 0) {
+			first_value = value;
+		} else {
+			uint64_t delta = uint64_t(value) - uint64_t(previous_value);
+			if (value_width == sizeof(int32_t)) {
+				// INT32 deltas wrap around, so they always fit in 32 bits
+				delta = uint64_t(int64_t(int32_t(uint32_t(delta))));
+			}
+			deltas[delta_count++] = int64_t(delta);
+			if (delta_count == BLOCK_SIZE_IN_VALUES) {
+				FlushBlock();
+			}
+		}
+		previous_value = value;
+		total_value_count++;
+	}
+
+	//! Writes the header followed by the blocks
+	void FinishWrite(Serializer &writer) {
+		D_ASSERT(!count_only);
+		FlushBlock();
+		// <block size in values> <number of miniblocks in a block> <total value count> <first value>
+		WriteVarint(writer, BLOCK_SIZE_IN_VALUES);
+		WriteVarint(writer, NUMBER_OF_MINIBLOCKS);
+		WriteVarint(writer, total_value_count);
+		WriteVarint(writer, IntToZigzag(first_value));
+		writer.WriteData(block_data.blob.data.get(), block_data.blob.size);
+	}
+
+	//! The number of bytes required to encode the values that have been written so far
+	idx_t GetByteCount() {
+		FlushBlock();
+		return GetVarintSize(BLOCK_SIZE_IN_VALUES) + GetVarintSize(NUMBER_OF_MINIBLOCKS) +
+		       GetVarintSize(total_value_count) + GetVarintSize(IntToZigzag(first_value)) + block_byte_count;
+	}
+
+private:
+	static uint64_t IntToZigzag(int64_t value) {
+		return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+	}
+
+	static idx_t GetVarintSize(uint64_t value) {
+		idx_t result = 1;
+		while (value >= 128) {
+			value >>= 7;
+			result++;
+		}
+		return result;
+	}
+
+	static void WriteVarint(Serializer &writer, uint64_t value) {
+		while (value >= 128) {
+			writer.Write<uint8_t>(uint8_t(value & 127) | 128);
+			value >>= 7;
+		}
+		writer.Write<uint8_t>(uint8_t(value));
+	}
+
+	static uint8_t GetBitWidth(uint64_t value) {
+		uint8_t result = 0;
+		while (value != 0) {
+			value >>= 1;
+			result++;
+		}
+		return result;
+	}
+
+	//! Bit-packs the values with the least significant bits first, as read by ParquetDecodeUtils::BitUnpack
+	static void BitPack(Serializer &writer, const uint64_t *values, idx_t count, uint8_t width) {
+		uint8_t current_byte = 0;
+		uint8_t bit_position = 0;
+		for (idx_t i = 0; i < count; i++) {
+			auto value = values[i];
+			uint8_t remaining = width;
+			while (remaining > 0) {
+				uint8_t bits = MinValue<uint8_t>(8 - bit_position, remaining);
+				current_byte |= uint8_t((value & ((uint64_t(1) << bits) - 1)) << bit_position);
+				value >>= bits;
+				remaining -= bits;
+				bit_position += bits;
+				if (bit_position == 8) {
+					writer.Write<uint8_t>(current_byte);
+					current_byte = 0;
+					bit_position = 0;
+				}
+			}
+		}
+		D_ASSERT(bit_position == 0);
+	}
+
+	void FlushBlock() {
+		if (delta_count == 0) {
+			return;
+		}
+		int64_t min_delta = deltas[0];
+		for (idx_t i = 1; i < delta_count; i++) {
+			min_delta = MinValue<int64_t>(min_delta, deltas[i]);
+		}
+		// the values of a miniblock are stored relative to the minimum delta, the last miniblock is padded with zeros
+		uint64_t values[BLOCK_SIZE_IN_VALUES];
+		uint8_t bit_widths[NUMBER_OF_MINIBLOCKS];
+		idx_t miniblock_count = (delta_count + VALUES_PER_MINIBLOCK - 1) / VALUES_PER_MINIBLOCK;
+		for (idx_t miniblock_idx = 0; miniblock_idx < NUMBER_OF_MINIBLOCKS; miniblock_idx++) {
+			uint64_t max_value = 0;
+			for (idx_t i = miniblock_idx * VALUES_PER_MINIBLOCK; i < (miniblock_idx + 1) * VALUES_PER_MINIBLOCK; i++) {
+				values[i] = i < delta_count ? uint64_t(deltas[i]) - uint64_t(min_delta) : 0;
+				if (value_width == sizeof(int32_t)) {
+					values[i] &= NumericLimits<uint32_t>::Maximum();
+				}
+				max_value |= values[i];
+			}
+			bit_widths[miniblock_idx] = miniblock_idx < miniblock_count ? GetBitWidth(max_value) : 0;
+		}
+
+		block_byte_count += GetVarintSize(IntToZigzag(min_delta)) + NUMBER_OF_MINIBLOCKS;
+		for (idx_t miniblock_idx = 0; miniblock_idx < miniblock_count; miniblock_idx++) {
+			block_byte_count += VALUES_PER_MINIBLOCK * bit_widths[miniblock_idx] / 8;
+		}
+		if (!count_only) {
+			WriteVarint(block_data, IntToZigzag(min_delta));
+			block_data.WriteData(bit_widths, NUMBER_OF_MINIBLOCKS);
+			// miniblocks that contain no values are omitted
+			for (idx_t miniblock_idx = 0; miniblock_idx < miniblock_count; miniblock_idx++) {
+				BitPack(block_data, values + miniblock_idx * VALUES_PER_MINIBLOCK, VALUES_PER_MINIBLOCK,
+				        bit_widths[miniblock_idx]);
+			}
+		}
+		delta_count = 0;
+	}
+
+private:
+	idx_t value_width;
+	bool count_only;
+
+	idx_t total_value_count;
+	int64_t first_value;
+	int64_t previous_value;
+
+	//! The deltas of the block that is being filled
+	int64_t deltas[BLOCK_SIZE_IN_VALUES];
+	idx_t delta_count;
+
+	//! The encoded blocks
+	BufferedSerializer block_data;
+	idx_t block_byte_count;
+};
+} // namespace duckdb
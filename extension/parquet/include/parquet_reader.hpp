@@ -51,12 +51,19 @@ struct ParquetReaderScanState {
 	int64_t current_group;
 	idx_t group_offset;
 	unique_ptr<FileHandle> file_handle;
+	//! Handles used to fetch the prefetched ranges of a remote file concurrently
+	unique_ptr<PrefetchHandlePool> prefetch_handle_pool;
 	unique_ptr<ColumnReader> root_reader;
 	unique_ptr<duckdb_apache::thrift::protocol::TProtocol> thrift_file_proto;
 
 	bool finished;
 	SelectionVector sel;
 
+	//! Row ranges [start, end) of the current row group that cannot match the filters according to the page index
+	vector<pair<idx_t, idx_t>> pruned_ranges;
+	//! The first range of pruned_ranges that has not been skipped yet
+	idx_t pruned_range_idx = 0;
+
 	ResizeableBuffer define_buf;
 	ResizeableBuffer repeat_buf;
 
@@ -71,6 +78,10 @@ struct ParquetOptions {
 
 	bool binary_as_string = false;
 	bool file_row_number = false;
+	//! The maximum number of concurrent requests used to prefetch the ranges of a remote file
+	idx_t prefetch_connections = PrefetchHandlePool::DEFAULT_MAX_HANDLES;
+	//! Prefetched ranges that are at most this many bytes apart are merged into a single request
+	idx_t prefetch_merge_gap = ReadHeadComparator::DEFAULT_ALLOW_GAP;
 	MultiFileReaderOptions file_options;
 
 public:
@@ -87,6 +98,8 @@ public:
 
 	FileSystem &fs;
 	Allocator &allocator;
+	//! The scheduler that runs the tasks prefetching the ranges of remote files
+	TaskScheduler &scheduler;
 	string file_name;
 	vector<LogicalType> return_types;
 	vector<string> names;
@@ -133,6 +146,11 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Uses the page indexes of the filtered columns to find the rows of the current row group that can be skipped
+	void PrunePages(ParquetReaderScanState &state);
+	//! Uses the Bloom filter of a column chunk (if any) to check whether the chunk can contain rows matching a filter
+	bool CheckBloomFilter(ParquetReaderScanState &state, ColumnReader &column_reader,
+	                      const duckdb_parquet::format::ColumnChunk &chunk, const TableFilter &filter);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -17,6 +17,10 @@ struct ParquetStatisticsUtils {
 
 	static duckdb::unique_ptr<BaseStatistics>
 	TransformColumnStatistics(const SchemaElement &s_ele, const LogicalType &type, const ColumnChunk &column_chunk);
+	//! Transforms the statistics of a column chunk or page
+	static duckdb::unique_ptr<BaseStatistics>
+	TransformColumnStatistics(const SchemaElement &s_ele, const LogicalType &type,
+	                          const duckdb_parquet::format::Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
@@ -25,15 +25,33 @@ namespace duckdb {
 class FileSystem;
 class FileOpener;
 
+struct ParquetPageIndex {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	//! The column index (if statistics are available for all pages)
+	duckdb::unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	duckdb_parquet::format::OffsetIndex offset_index;
+};
+
 struct PreparedRowGroup {
 	duckdb_parquet::format::RowGroup row_group;
 	vector<duckdb::unique_ptr<ColumnWriterState>> states;
 };
 
+//! The version of the Parquet format that is written
+enum class ParquetVersion : uint8_t {
+	//! Only the encodings of the first version of the format (PLAIN, RLE and dictionary encodings)
+	V1 = 1,
+	//! Also use the DELTA_BINARY_PACKED, DELTA_BYTE_ARRAY and BYTE_STREAM_SPLIT encodings, which older readers might
+	//! not support
+	V2 = 2
+};
+
 class ParquetWriter {
 public:
 	ParquetWriter(FileSystem &fs, string file_name, vector<LogicalType> types, vector<string> names,
-	              duckdb_parquet::format::CompressionCodec::type codec);
+	              duckdb_parquet::format::CompressionCodec::type codec, const vector<idx_t> &bloom_filter_columns = {},
+	              double bloom_filter_fpp = 0, ParquetVersion parquet_version = ParquetVersion::V1);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -50,23 +68,35 @@ public:
 	duckdb_parquet::format::CompressionCodec::type GetCodec() {
 		return codec;
 	}
+	ParquetVersion GetParquetVersion() const {
+		return parquet_version;
+	}
 	duckdb_parquet::format::Type::type GetType(idx_t schema_idx) {
 		return file_meta_data.schema[schema_idx].type;
 	}
 	BufferedFileWriter &GetWriter() {
 		return *writer;
 	}
+	//! Registers the page index of a column chunk of the row group that is being flushed. The page indexes are
+	//! written right before the footer.
+	void RegisterPageIndex(idx_t column_idx, duckdb::unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                       duckdb_parquet::format::OffsetIndex offset_index);
+
+private:
+	void WritePageIndexes();
 
 private:
 	string file_name;
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec;
+	ParquetVersion parquet_version;
 
 	duckdb::unique_ptr<BufferedFileWriter> writer;
 	shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
 	duckdb_parquet::format::FileMetaData file_meta_data;
 	std::mutex lock;
+	vector<ParquetPageIndex> page_indexes;
 
 	vector<duckdb::unique_ptr<ColumnWriter>> column_writers;
 };
@@ -1,15 +1,21 @@
 #pragma once
+#include <future>
 #include <list>
 #include "thrift/protocol/TCompactProtocol.h"
 #include "thrift/transport/TBufferTransports.h"
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/parallel/task.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #endif
 
 namespace duckdb {
+struct ReadHeadFetch;
 
 // A ReadHead for prefetching data in a specific range
 struct ReadHead {
@@ -21,6 +27,8 @@ struct ReadHead {
 	// Current info
 	AllocatedData data;
 	bool data_isset = false;
+	// Set while the data is being fetched concurrently by a prefetch task
+	ReadHeadFetch *fetch = nullptr;
 
 	idx_t GetEnd() const {
 		return size + location;
@@ -31,27 +39,162 @@ struct ReadHead {
 	}
 };
 
-// Comparator for ReadHeads that are either overlapping, adjacent, or within ALLOW_GAP bytes from each other
+// Comparator for ReadHeads that are either overlapping, adjacent, or within allow_gap bytes from each other
 struct ReadHeadComparator {
-	static constexpr uint64_t ALLOW_GAP = 1 << 14; // 16 KiB
+	static constexpr uint64_t DEFAULT_ALLOW_GAP = 1 << 14; // 16 KiB
+
+	explicit ReadHeadComparator(uint64_t allow_gap = DEFAULT_ALLOW_GAP) : allow_gap(allow_gap) {
+	}
+
+	uint64_t allow_gap;
+
 	bool operator()(const ReadHead *a, const ReadHead *b) const {
 		auto a_start = a->location;
 		auto a_end = a->location + a->size;
 		auto b_start = b->location;
 
-		if (a_end <= NumericLimits<idx_t>::Maximum() - ALLOW_GAP) {
-			a_end += ALLOW_GAP;
+		if (a_end <= NumericLimits<idx_t>::Maximum() - allow_gap) {
+			a_end += allow_gap;
 		}
 
 		return a_start < b_start && a_end < b_start;
 	}
 };
 
+// A bounded pool of file handles to the same (remote) file, used by the prefetch tasks that fetch the prefetched
+// ranges concurrently on the threads of the task scheduler
+class PrefetchHandlePool {
+public:
+	static constexpr idx_t DEFAULT_MAX_HANDLES = 8;
+
+	PrefetchHandlePool(FileSystem &fs, TaskScheduler &scheduler, string path, uint8_t flags, idx_t max_handles)
+	    : fs(fs), scheduler(scheduler), producer(scheduler.CreateProducer()), path(std::move(path)), flags(flags),
+	      max_handles(max_handles) {
+	}
+
+	// The maximum number of ranges that are fetched concurrently
+	idx_t MaxHandles() const {
+		return max_handles;
+	}
+
+	// Get a handle from the pool, opening a new one if none are available
+	unique_ptr<FileHandle> Acquire() {
+		{
+			lock_guard<mutex> guard(lock);
+			if (!handles.empty()) {
+				auto handle = std::move(handles.back());
+				handles.pop_back();
+				return handle;
+			}
+		}
+		return fs.OpenFile(path, flags);
+	}
+
+	// Return a handle to the pool, so that the next prefetch can reuse its connection
+	void Release(unique_ptr<FileHandle> handle) {
+		lock_guard<mutex> guard(lock);
+		handles.push_back(std::move(handle));
+	}
+
+	// Whether there are threads that run the prefetch tasks besides the scanning thread
+	bool CanFetchConcurrently() {
+		return max_handles > 1 && scheduler.NumberOfThreads() > 1;
+	}
+
+	// Schedule a prefetch task on the task scheduler
+	void ScheduleTask(shared_ptr<Task> task) {
+		scheduler.ScheduleTask(*producer, std::move(task));
+	}
+
+private:
+	FileSystem &fs;
+	TaskScheduler &scheduler;
+	unique_ptr<ProducerToken> producer;
+	string path;
+	uint8_t flags;
+	idx_t max_handles;
+
+	mutex lock;
+	vector<unique_ptr<FileHandle>> handles;
+};
+
+// A read head that is fetched concurrently. It is read by whoever claims it first: either a prefetch task, or the scan
+// itself if it needs the data before any prefetch task got to it.
+struct ReadHeadFetch {
+	explicit ReadHeadFetch(ReadHead &read_head) : read_head(read_head), claimed(false), done(promise.get_future()) {
+	}
+
+	ReadHead &read_head;
+	atomic<bool> claimed;
+	// Resolved once a prefetch task has read the data (or failed to)
+	std::promise<void> promise;
+	std::future<void> done;
+
+	// Returns true if the caller has to read the data
+	bool Claim() {
+		return !claimed.exchange(true);
+	}
+};
+
+// The read heads of a single prefetch, shared between the scan and its prefetch tasks. The tasks can outlive the scan:
+// they only touch a read head (and the handle pool) after claiming it, and the scan waits for all claimed read heads
+// before they go away.
+struct PrefetchBatch {
+	explicit PrefetchBatch(PrefetchHandlePool &handle_pool) : handle_pool(handle_pool) {
+	}
+
+	PrefetchHandlePool &handle_pool;
+	vector<unique_ptr<ReadHeadFetch>> fetches;
+	atomic<idx_t> next_fetch {0};
+
+	// Fetch the read heads that have not been claimed yet
+	void FetchReadHeads() {
+		while (true) {
+			auto idx = next_fetch++;
+			if (idx >= fetches.size()) {
+				return;
+			}
+			auto &fetch = *fetches[idx];
+			if (!fetch.Claim()) {
+				continue;
+			}
+			auto &read_head = fetch.read_head;
+			try {
+				auto fetch_handle = handle_pool.Acquire();
+				fetch_handle->Read(read_head.data.get(), read_head.size, read_head.location);
+				handle_pool.Release(std::move(fetch_handle));
+				fetch.promise.set_value();
+			} catch (...) {
+				fetch.promise.set_exception(std::current_exception());
+			}
+		}
+	}
+};
+
+class PrefetchTask : public Task {
+public:
+	explicit PrefetchTask(shared_ptr<PrefetchBatch> batch_p) : batch(std::move(batch_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		batch->FetchReadHeads();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<PrefetchBatch> batch;
+};
+
 // Two-step read ahead buffer
 // 1: register all ranges that will be read, merging ranges that are consecutive
-// 2: prefetch all registered ranges
+// 2: prefetch all registered ranges, concurrently if a handle pool is available
 struct ReadAheadBuffer {
-	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
+	ReadAheadBuffer(Allocator &allocator, FileHandle &handle, PrefetchHandlePool *handle_pool = nullptr,
+	                uint64_t allow_gap = ReadHeadComparator::DEFAULT_ALLOW_GAP)
+	    : merge_set(ReadHeadComparator(allow_gap)), allocator(allocator), handle(handle), handle_pool(handle_pool) {
+	}
+	~ReadAheadBuffer() {
+		WaitForPrefetch();
 	}
 
 	// The list of read heads
@@ -61,9 +204,14 @@ struct ReadAheadBuffer {
 
 	Allocator &allocator;
 	FileHandle &handle;
+	// Pool of handles used to fetch the read heads concurrently (if any)
+	PrefetchHandlePool *handle_pool;
 
 	idx_t total_size = 0;
 
+	// The read heads that are being fetched by prefetch tasks (if any)
+	shared_ptr<PrefetchBatch> prefetch_batch;
+
 	// Add a read head to the prefetching list
 	void AddReadHead(idx_t pos, uint64_t len, bool merge_buffers = true) {
 		// Attempt to merge with existing
@@ -105,16 +253,77 @@ struct ReadAheadBuffer {
 
 	// Prefetch all read heads
 	void Prefetch() {
+		WaitForPrefetch();
+		vector<ReadHead *> fetch_list;
 		for (auto &read_head : read_heads) {
-			read_head.Allocate(allocator);
-
+			if (read_head.data_isset) {
+				continue;
+			}
 			if (read_head.GetEnd() > handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
+			read_head.Allocate(allocator);
+			fetch_list.push_back(&read_head);
+		}
+		if (!handle_pool || !handle_pool->CanFetchConcurrently() || fetch_list.size() <= 1) {
+			// a single range (or no concurrency): read synchronously
+			for (auto read_head : fetch_list) {
+				handle.Read(read_head->data.get(), read_head->size, read_head->location);
+				read_head->data_isset = true;
+			}
+			return;
+		}
+		// issue the requests concurrently, the scan waits for a read head only once it needs its data
+		prefetch_batch = make_shared<PrefetchBatch>(*handle_pool);
+		for (auto read_head : fetch_list) {
+			prefetch_batch->fetches.push_back(make_uniq<ReadHeadFetch>(*read_head));
+			read_head->fetch = prefetch_batch->fetches.back().get();
+		}
+		auto task_count = MinValue<idx_t>(handle_pool->MaxHandles(), fetch_list.size());
+		for (idx_t i = 0; i < task_count; i++) {
+			handle_pool->ScheduleTask(make_shared<PrefetchTask>(prefetch_batch));
+		}
+	}
 
+	// Wait for the data of a read head that is being fetched concurrently (if any), rethrowing any error
+	// If no prefetch task has started to fetch it yet, it is read right away
+	void WaitForReadHead(ReadHead &read_head) {
+		if (!read_head.fetch) {
+			return;
+		}
+		auto &fetch = *read_head.fetch;
+		read_head.fetch = nullptr;
+		if (fetch.Claim()) {
 			handle.Read(read_head.data.get(), read_head.size, read_head.location);
-			read_head.data_isset = true;
+		} else {
+			fetch.done.get();
+		}
+		read_head.data_isset = true;
+	}
+
+	// Wait until the prefetch tasks have finished the read heads they are fetching
+	// Read heads that have not been fetched yet are left to be read when they are needed
+	void WaitForPrefetch() {
+		if (!prefetch_batch) {
+			return;
+		}
+		for (auto &read_head : read_heads) {
+			if (!read_head.fetch) {
+				continue;
+			}
+			auto &fetch = *read_head.fetch;
+			read_head.fetch = nullptr;
+			if (fetch.Claim()) {
+				continue;
+			}
+			try {
+				fetch.done.get();
+				read_head.data_isset = true;
+			} catch (...) {
+				// the read head is read again (and the error is thrown) once its data is needed
+			}
 		}
+		prefetch_batch.reset();
 	}
 };
 
@@ -122,8 +331,10 @@ class ThriftFileTransport : public duckdb_apache::thrift::transport::TVirtualTra
 public:
 	static constexpr uint64_t PREFETCH_FALLBACK_BUFFERSIZE = 1000000;
 
-	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p)
-	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(ReadAheadBuffer(allocator, handle_p)),
+	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p,
+	                    PrefetchHandlePool *handle_pool = nullptr,
+	                    uint64_t allow_gap = ReadHeadComparator::DEFAULT_ALLOW_GAP)
+	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(allocator, handle_p, handle_pool, allow_gap),
 	      prefetch_mode(prefetch_mode_p) {
 	}
 
@@ -132,6 +343,7 @@ public:
 		if (prefetch_buffer != nullptr && location - prefetch_buffer->location + len <= prefetch_buffer->size) {
 			D_ASSERT(location - prefetch_buffer->location + len <= prefetch_buffer->size);
 
+			ra_buffer.WaitForReadHead(*prefetch_buffer);
 			if (!prefetch_buffer->data_isset) {
 				prefetch_buffer->Allocate(allocator);
 				handle.Read(prefetch_buffer->data.get(), prefetch_buffer->size, prefetch_buffer->location);
@@ -175,6 +387,7 @@ public:
 	}
 
 	void ClearPrefetch() {
+		ra_buffer.WaitForPrefetch();
 		ra_buffer.read_heads.clear();
 		ra_buffer.merge_set.clear();
 	}
@@ -15,6 +15,7 @@
 #include <vector>
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/bind_helpers.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/enums/file_compression_type.hpp"
 #include "duckdb/common/field_writer.hpp"
@@ -116,6 +117,12 @@ struct ParquetWriteBindData : public TableFunctionData {
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec = duckdb_parquet::format::CompressionCodec::SNAPPY;
 	idx_t row_group_size = RowGroup::ROW_GROUP_SIZE;
+	//! The (top-level) columns for which Bloom filters are written
+	vector<idx_t> bloom_filter_columns;
+	//! The false positive probability of the Bloom filters
+	double bloom_filter_fpp = 0.01;
+	//! The version of the Parquet format, which determines the encodings that can be used
+	ParquetVersion parquet_version = ParquetVersion::V1;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -134,12 +141,16 @@ void ParquetOptions::Serialize(FieldWriter &writer) const {
 	writer.WriteField<bool>(binary_as_string);
 	writer.WriteField<bool>(file_row_number);
 	writer.WriteSerializable(file_options);
+	writer.WriteField<idx_t>(prefetch_connections);
+	writer.WriteField<idx_t>(prefetch_merge_gap);
 }
 
 void ParquetOptions::Deserialize(FieldReader &reader) {
 	binary_as_string = reader.ReadRequired<bool>();
 	file_row_number = reader.ReadRequired<bool>();
 	file_options = reader.ReadRequiredSerializable<MultiFileReaderOptions, MultiFileReaderOptions>();
+	prefetch_connections = reader.ReadRequired<idx_t>();
+	prefetch_merge_gap = reader.ReadRequired<idx_t>();
 }
 
 BindInfo ParquetGetBatchInfo(const FunctionData *bind_data) {
@@ -610,6 +621,42 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyInfo &info
 				}
 			}
 			throw ParserException("Expected %s argument to be either [uncompressed, snappy, gzip or zstd]", loption);
+		} else if (loption == "bloom_filter_columns") {
+			auto bloom_filter_columns = ParseColumnList(ConvertVectorToValue(option.second), names, loption);
+			bind_data->bloom_filter_columns.clear();
+			for (idx_t col_idx = 0; col_idx < bloom_filter_columns.size(); col_idx++) {
+				if (!bloom_filter_columns[col_idx]) {
+					continue;
+				}
+				switch (sql_types[col_idx].id()) {
+				case LogicalTypeId::BOOLEAN:
+				case LogicalTypeId::INTERVAL:
+				case LogicalTypeId::ENUM:
+				case LogicalTypeId::STRUCT:
+				case LogicalTypeId::LIST:
+				case LogicalTypeId::MAP:
+				case LogicalTypeId::UNION:
+					throw BinderException("\"%s\" is not supported for column \"%s\" of type %s", loption,
+					                      names[col_idx], sql_types[col_idx].ToString());
+				default:
+					bind_data->bloom_filter_columns.push_back(col_idx);
+				}
+			}
+		} else if (loption == "bloom_filter_fpp") {
+			auto fpp = option.second.empty() ? 0.0 : option.second[0].GetValue<double>();
+			if (fpp <= 0 || fpp >= 1) {
+				throw BinderException("\"%s\" expects a false positive probability between 0 and 1", loption);
+			}
+			bind_data->bloom_filter_fpp = fpp;
+		} else if (loption == "parquet_version") {
+			auto roption = option.second.empty() ? string() : StringUtil::Upper(option.second[0].ToString());
+			if (roption == "V1") {
+				bind_data->parquet_version = ParquetVersion::V1;
+			} else if (roption == "V2") {
+				bind_data->parquet_version = ParquetVersion::V2;
+			} else {
+				throw BinderException("Expected %s argument to be either [V1, V2]", loption);
+			}
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
@@ -626,7 +673,9 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 
 	auto &fs = FileSystem::GetFileSystem(context);
 	global_state->writer =
-	    make_uniq<ParquetWriter>(fs, file_path, parquet_bind.sql_types, parquet_bind.column_names, parquet_bind.codec);
+	    make_uniq<ParquetWriter>(fs, file_path, parquet_bind.sql_types, parquet_bind.column_names, parquet_bind.codec,
+	                             parquet_bind.bloom_filter_columns, parquet_bind.bloom_filter_fpp,
+	                             parquet_bind.parquet_version);
 	return std::move(global_state);
 }
 
@@ -772,6 +821,13 @@ void ParquetExtension::Load(DuckDB &db) {
 	config.replacement_scans.emplace_back(ParquetScanReplacement);
 	config.AddExtensionOption("binary_as_string", "In Parquet files, interpret binary data as a string.",
 	                          LogicalType::BOOLEAN);
+	config.AddExtensionOption("parquet_prefetch_connections",
+	                          "Maximum number of concurrent requests used to prefetch ranges of remote Parquet files",
+	                          LogicalType::UBIGINT, Value::UBIGINT(PrefetchHandlePool::DEFAULT_MAX_HANDLES));
+	config.AddExtensionOption("parquet_prefetch_merge_gap",
+	                          "Prefetched ranges of remote Parquet files that are at most this many bytes apart are "
+	                          "fetched with a single request",
+	                          LogicalType::UBIGINT, Value::UBIGINT(ReadHeadComparator::DEFAULT_ALLOW_GAP));
 }
 
 std::string ParquetExtension::Name() {
@@ -0,0 +1,228 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#endif
+
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocol;
+using duckdb_apache::thrift::protocol::TType;
+
+//! The salt values of the split block Bloom filter, as defined by the Parquet specification
+static constexpr const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+//! Field ids of the BloomFilterHeader struct (and of the members of its union fields)
+static constexpr const int16_t BLOOM_FILTER_NUM_BYTES_ID = 1;
+static constexpr const int16_t BLOOM_FILTER_ALGORITHM_ID = 2;
+static constexpr const int16_t BLOOM_FILTER_HASH_ID = 3;
+static constexpr const int16_t BLOOM_FILTER_COMPRESSION_ID = 4;
+static constexpr const int16_t BLOOM_FILTER_BLOCK_ID = 1;
+static constexpr const int16_t BLOOM_FILTER_XXHASH_ID = 1;
+static constexpr const int16_t BLOOM_FILTER_UNCOMPRESSED_ID = 1;
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_bytes) {
+	D_ASSERT(num_bytes % BYTES_PER_BLOCK == 0 && num_bytes > 0);
+	num_blocks = num_bytes / BYTES_PER_BLOCK;
+	blocks = unique_ptr<uint32_t[]>(new uint32_t[num_bytes / sizeof(uint32_t)]);
+	memset(blocks.get(), 0, num_bytes);
+}
+
+idx_t ParquetBloomFilter::OptimalNumBytes(idx_t distinct_count, double fpp) {
+	D_ASSERT(fpp > 0 && fpp < 1);
+	// m = -k * n / ln(1 - p^(1/k)) with k = 8 bits set per value
+	double num_bits = -8.0 * double(MaxValue<idx_t>(distinct_count, 1)) / std::log(1.0 - std::pow(fpp, 1.0 / 8.0));
+	idx_t num_bytes = MINIMUM_BYTES;
+	while (num_bytes < MAXIMUM_BYTES && double(num_bytes * 8) < num_bits) {
+		num_bytes *= 2;
+	}
+	return num_bytes;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+void ParquetBloomFilter::InsertHash(uint64_t hash) {
+	auto block = blocks.get() + ((((hash >> 32) * num_blocks) >> 32) * 8);
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		block[i] |= uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FindHash(uint64_t hash) const {
+	auto block = blocks.get() + ((((hash >> 32) * num_blocks) >> 32) * 8);
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		if (!(block[i] & (uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Writes a union field of which the member with the given id is set, all union members are empty structs
+static void WriteUnionField(TProtocol &protocol, int16_t field_id, int16_t member_id) {
+	protocol.writeFieldBegin("", TType::T_STRUCT, field_id);
+	protocol.writeStructBegin("");
+	protocol.writeFieldBegin("", TType::T_STRUCT, member_id);
+	protocol.writeStructBegin("");
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+}
+
+//! Reads a union field, returns whether the member with the given id is set
+static bool ReadUnionField(TProtocol &protocol, int16_t member_id) {
+	bool found = false;
+	string name;
+	TType field_type;
+	int16_t field_id;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == TType::T_STOP) {
+			break;
+		}
+		if (field_id == member_id && field_type == TType::T_STRUCT) {
+			found = true;
+		}
+		protocol.skip(field_type);
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	return found;
+}
+
+void ParquetBloomFilter::Write(TProtocol &protocol, Serializer &writer) const {
+	auto num_bytes = num_blocks * BYTES_PER_BLOCK;
+	protocol.writeStructBegin("BloomFilterHeader");
+	protocol.writeFieldBegin("numBytes", TType::T_I32, BLOOM_FILTER_NUM_BYTES_ID);
+	protocol.writeI32(int32_t(num_bytes));
+	protocol.writeFieldEnd();
+	WriteUnionField(protocol, BLOOM_FILTER_ALGORITHM_ID, BLOOM_FILTER_BLOCK_ID);
+	WriteUnionField(protocol, BLOOM_FILTER_HASH_ID, BLOOM_FILTER_XXHASH_ID);
+	WriteUnionField(protocol, BLOOM_FILTER_COMPRESSION_ID, BLOOM_FILTER_UNCOMPRESSED_ID);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	// the bitset follows the header, the words are stored in little endian
+	writer.WriteData(const_data_ptr_cast(blocks.get()), num_bytes);
+}
+
+unique_ptr<ParquetBloomFilter> ParquetBloomFilter::Read(TProtocol &protocol) {
+	int32_t num_bytes = 0;
+	bool supported_algorithm = false;
+	bool supported_hash = false;
+	bool supported_compression = false;
+
+	string name;
+	TType field_type;
+	int16_t field_id;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == TType::T_STOP) {
+			break;
+		}
+		if (field_id == BLOOM_FILTER_NUM_BYTES_ID && field_type == TType::T_I32) {
+			protocol.readI32(num_bytes);
+		} else if (field_id == BLOOM_FILTER_ALGORITHM_ID && field_type == TType::T_STRUCT) {
+			supported_algorithm = ReadUnionField(protocol, BLOOM_FILTER_BLOCK_ID);
+		} else if (field_id == BLOOM_FILTER_HASH_ID && field_type == TType::T_STRUCT) {
+			supported_hash = ReadUnionField(protocol, BLOOM_FILTER_XXHASH_ID);
+		} else if (field_id == BLOOM_FILTER_COMPRESSION_ID && field_type == TType::T_STRUCT) {
+			supported_compression = ReadUnionField(protocol, BLOOM_FILTER_UNCOMPRESSED_ID);
+		} else {
+			protocol.skip(field_type);
+		}
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+
+	if (!supported_algorithm || !supported_hash || !supported_compression || num_bytes <= 0 ||
+	    idx_t(num_bytes) % BYTES_PER_BLOCK != 0 || idx_t(num_bytes) > MAXIMUM_BYTES) {
+		return nullptr;
+	}
+	auto result = make_uniq<ParquetBloomFilter>(num_bytes);
+	protocol.getTransport()->readAll(data_ptr_cast(result->blocks.get()), num_bytes);
+	return result;
+}
+
+bool ParquetBloomFilter::HashConstant(const Value &constant, duckdb_parquet::format::Type::type physical_type,
+                                      uint64_t &result) {
+	using duckdb_parquet::format::Type;
+	if (constant.IsNull()) {
+		return false;
+	}
+	switch (constant.type().id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER: {
+		if (physical_type != Type::INT32) {
+			return false;
+		}
+		// unsigned integers are stored as the (reinterpreted) bits of an INT32
+		auto value = uint32_t(constant.GetValue<int64_t>());
+		result = Hash(const_data_ptr_cast(&value), sizeof(value));
+		return true;
+	}
+	case LogicalTypeId::DATE: {
+		if (physical_type != Type::INT32) {
+			return false;
+		}
+		auto value = constant.GetValue<date_t>().days;
+		result = Hash(const_data_ptr_cast(&value), sizeof(value));
+		return true;
+	}
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UBIGINT: {
+		if (physical_type != Type::INT64) {
+			return false;
+		}
+		auto value = constant.type().id() == LogicalTypeId::BIGINT ? uint64_t(BigIntValue::Get(constant))
+		                                                          : UBigIntValue::Get(constant);
+		result = Hash(const_data_ptr_cast(&value), sizeof(value));
+		return true;
+	}
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB: {
+		if (physical_type != Type::BYTE_ARRAY) {
+			return false;
+		}
+		auto &value = StringValue::Get(constant);
+		result = Hash(const_data_ptr_cast(value.c_str()), value.size());
+		return true;
+	}
+	case LogicalTypeId::UUID: {
+		if (physical_type != Type::FIXED_LEN_BYTE_ARRAY) {
+			return false;
+		}
+		// UUIDs are stored as 16 big-endian bytes, DuckDB flips the sign bit of the upper half
+		auto value = constant.GetValue<hugeint_t>();
+		uint64_t halves[2] = {uint64_t(value.upper) ^ (uint64_t(1) << 63), value.lower};
+		data_t bytes[16];
+		for (idx_t i = 0; i < 16; i++) {
+			bytes[i] = (halves[i / 8] >> ((7 - i % 8) * 8)) & 0xFF;
+		}
+		result = Hash(bytes, sizeof(bytes));
+		return true;
+	}
+	default:
+		// floating point values (-0.0 and 0.0 hash differently) and types with units (e.g. timestamps) are skipped
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -1,4 +1,5 @@
 #include "parquet_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_timestamp.hpp"
 #include "parquet_statistics.hpp"
 #include "column_reader.hpp"
@@ -18,6 +19,7 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
@@ -49,8 +51,10 @@ using duckdb_parquet::format::Statistics;
 using duckdb_parquet::format::Type;
 
 static duckdb::unique_ptr<duckdb_apache::thrift::protocol::TProtocol>
-CreateThriftProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode) {
-	auto transport = make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode);
+CreateThriftProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode,
+                     PrefetchHandlePool *handle_pool = nullptr,
+                     uint64_t allow_gap = ReadHeadComparator::DEFAULT_ALLOW_GAP) {
+	auto transport = make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode, handle_pool, allow_gap);
 	return make_uniq<duckdb_apache::thrift::protocol::TCompactProtocolT<ThriftFileTransport>>(std::move(transport));
 }
 
@@ -425,11 +429,18 @@ ParquetOptions::ParquetOptions(ClientContext &context) {
 	if (context.TryGetCurrentSetting("binary_as_string", binary_as_string_val)) {
 		binary_as_string = binary_as_string_val.GetValue<bool>();
 	}
+	Value prefetch_val;
+	if (context.TryGetCurrentSetting("parquet_prefetch_connections", prefetch_val)) {
+		prefetch_connections = prefetch_val.GetValue<uint64_t>();
+	}
+	if (context.TryGetCurrentSetting("parquet_prefetch_merge_gap", prefetch_val)) {
+		prefetch_merge_gap = prefetch_val.GetValue<uint64_t>();
+	}
 }
 
 ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, ParquetOptions parquet_options_p)
     : fs(FileSystem::GetFileSystem(context_p)), allocator(BufferAllocator::Get(context_p)),
-      parquet_options(parquet_options_p) {
+      scheduler(TaskScheduler::GetScheduler(context_p)), parquet_options(parquet_options_p) {
 	file_name = std::move(file_name_p);
 	file_handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ);
 	if (!file_handle->CanSeek()) {
@@ -457,7 +468,8 @@ ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, Parqu
 ParquetReader::ParquetReader(ClientContext &context_p, ParquetOptions parquet_options_p,
                              shared_ptr<ParquetFileMetadataCache> metadata_p)
     : fs(FileSystem::GetFileSystem(context_p)), allocator(BufferAllocator::Get(context_p)),
-      metadata(std::move(metadata_p)), parquet_options(parquet_options_p) {
+      scheduler(TaskScheduler::GetScheduler(context_p)), metadata(std::move(metadata_p)),
+      parquet_options(parquet_options_p) {
 	InitializeSchema();
 }
 
@@ -581,11 +593,13 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		// filters contain output chunk index, not file col idx!
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
-		if (stats && filter_entry != reader_data.filters->filters.end()) {
+		if (filter_entry != reader_data.filters->filters.end()) {
 			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
-			auto prune_result = filter.CheckStatistics(*stats);
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			if (stats && filter.CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				skip_chunk = true;
+			} else if (column_reader->FileIdx() < group.columns.size() &&
+			           !CheckBloomFilter(state, *column_reader, group.columns[column_reader->FileIdx()], filter)) {
 				skip_chunk = true;
 			}
 			if (skip_chunk) {
@@ -600,6 +614,158 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+//! Whether any of the values matching the filter can be in the Bloom filter
+static bool BloomFilterMayMatch(const ParquetBloomFilter &bloom_filter, const TableFilter &filter,
+                                const LogicalType &type, duckdb_parquet::format::Type::type physical_type) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		uint64_t hash;
+		auto &constant = constant_filter.constant;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL || constant.type() != type ||
+		    !ParquetBloomFilter::HashConstant(constant, physical_type, hash)) {
+			return true;
+		}
+		return bloom_filter.FindHash(hash);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterMayMatch(bloom_filter, *child_filter, type, physical_type)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterMayMatch(bloom_filter, *child_filter, type, physical_type)) {
+				return true;
+			}
+		}
+		return conjunction.child_filters.empty();
+	}
+	default:
+		return true;
+	}
+}
+
+bool ParquetReader::CheckBloomFilter(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                     const duckdb_parquet::format::ColumnChunk &chunk, const TableFilter &filter) {
+	if (!chunk.meta_data.__isset.bloom_filter_offset || column_reader.MaxRepeat() > 0 ||
+	    column_reader.Type() != DeriveLogicalType(column_reader.Schema())) {
+		// no Bloom filter, or the values are converted while reading (e.g., decimals or casts)
+		return true;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	trans.SetLocation(chunk.meta_data.bloom_filter_offset);
+	auto bloom_filter = ParquetBloomFilter::Read(*state.thrift_file_proto);
+	if (state.prefetch_mode) {
+		// the Bloom filter was read using the prefetch fallback, drop it before prefetching the column data
+		trans.ClearPrefetch();
+	}
+	if (!bloom_filter) {
+		return true;
+	}
+	return BloomFilterMayMatch(*bloom_filter, filter, column_reader.Type(), column_reader.Schema().type);
+}
+
+void ParquetReader::PrunePages(ParquetReaderScanState &state) {
+	state.pruned_ranges.clear();
+	state.pruned_range_idx = 0;
+
+	auto &group = GetGroup(state);
+	if (!reader_data.filters || state.group_offset == (idx_t)group.num_rows) {
+		return;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	bool read_page_index = false;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		// filters contain output chunk index, not file col idx!
+		auto filter_entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
+		if (filter_entry == reader_data.filters->filters.end()) {
+			continue;
+		}
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		if (column_reader->MaxRepeat() > 0 || !column_reader->Stats(state.group_idx_list[state.current_group],
+		                                                             group.columns)) {
+			// no statistics for this column (e.g., nested or cast columns)
+			continue;
+		}
+		auto file_col_idx = column_reader->FileIdx();
+		if (file_col_idx >= group.columns.size()) {
+			// virtual column (e.g., the file_row_number)
+			continue;
+		}
+		auto &chunk = group.columns[file_col_idx];
+		if (!chunk.__isset.column_index_offset || !chunk.__isset.offset_index_offset) {
+			continue;
+		}
+		duckdb_parquet::format::ColumnIndex column_index;
+		duckdb_parquet::format::OffsetIndex offset_index;
+		trans.SetLocation(chunk.column_index_offset);
+		column_index.read(state.thrift_file_proto.get());
+		trans.SetLocation(chunk.offset_index_offset);
+		offset_index.read(state.thrift_file_proto.get());
+		read_page_index = true;
+
+		auto &page_locations = offset_index.page_locations;
+		auto page_count = page_locations.size();
+		if (column_index.null_pages.size() != page_count || column_index.min_values.size() != page_count ||
+		    column_index.max_values.size() != page_count) {
+			throw InvalidInputException("Malformed parquet file: page index of column \"%s\" is inconsistent",
+			                            column_reader->Schema().name);
+		}
+		auto &filter = *filter_entry->second;
+		for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+			if (column_index.null_pages[page_idx]) {
+				// no min/max for pages that only contain NULL values
+				continue;
+			}
+			duckdb_parquet::format::Statistics page_stats;
+			page_stats.min_value = column_index.min_values[page_idx];
+			page_stats.__isset.min_value = true;
+			page_stats.max_value = column_index.max_values[page_idx];
+			page_stats.__isset.max_value = true;
+			if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+				page_stats.null_count = column_index.null_counts[page_idx];
+				page_stats.__isset.null_count = true;
+			}
+			auto stats = ParquetStatisticsUtils::TransformColumnStatistics(column_reader->Schema(),
+			                                                               column_reader->Type(), page_stats);
+			if (!stats || filter.CheckStatistics(*stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				continue;
+			}
+			idx_t start = page_locations[page_idx].first_row_index;
+			idx_t end = page_idx + 1 < page_count ? page_locations[page_idx + 1].first_row_index : group.num_rows;
+			if (start < end) {
+				state.pruned_ranges.emplace_back(start, end);
+			}
+		}
+	}
+	if (read_page_index && state.prefetch_mode) {
+		// the page index was read using the prefetch fallback, drop it before prefetching the column data
+		trans.ClearPrefetch();
+	}
+	if (state.pruned_ranges.empty()) {
+		return;
+	}
+	// the filters are conjunctive: a row can be skipped if any filter excludes it, so we merge the ranges
+	std::sort(state.pruned_ranges.begin(), state.pruned_ranges.end());
+	idx_t merged_count = 0;
+	for (auto &range : state.pruned_ranges) {
+		if (merged_count > 0 && range.first <= state.pruned_ranges[merged_count - 1].second) {
+			auto &last = state.pruned_ranges[merged_count - 1];
+			last.second = MaxValue<idx_t>(last.second, range.second);
+		} else {
+			state.pruned_ranges[merged_count++] = range;
+		}
+	}
+	state.pruned_ranges.resize(merged_count);
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -614,6 +780,8 @@ void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t>
 	state.group_offset = 0;
 	state.group_idx_list = std::move(groups_to_read);
 	state.sel.Initialize(STANDARD_VECTOR_SIZE);
+	// any ongoing prefetches use the handles of the state: wait for them to finish first
+	state.thrift_file_proto.reset();
 	if (!state.file_handle || state.file_handle->path != file_handle->path) {
 		auto flags = FileFlags::FILE_FLAGS_READ;
 
@@ -625,9 +793,18 @@ void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t>
 		}
 
 		state.file_handle = fs.OpenFile(file_handle->path, flags);
+		state.prefetch_handle_pool.reset();
+#ifndef DUCKDB_NO_THREADS
+		if (state.prefetch_mode && parquet_options.prefetch_connections > 1) {
+			state.prefetch_handle_pool = make_uniq<PrefetchHandlePool>(fs, scheduler, file_handle->path, flags,
+			                                                           parquet_options.prefetch_connections);
+		}
+#endif
 	}
 
-	state.thrift_file_proto = CreateThriftProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	state.thrift_file_proto =
+	    CreateThriftProtocol(allocator, *state.file_handle, state.prefetch_mode, state.prefetch_handle_pool.get(),
+	                         parquet_options.prefetch_merge_gap);
 	state.root_reader = CreateReader();
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
@@ -849,6 +1026,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PrunePages(state);
 
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
@@ -901,6 +1079,29 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	}
 
 	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
+	// skip the rows that were pruned using the page index
+	while (state.pruned_range_idx < state.pruned_ranges.size()) {
+		auto &range = state.pruned_ranges[state.pruned_range_idx];
+		if (state.group_offset >= range.second) {
+			state.pruned_range_idx++;
+			continue;
+		}
+		if (state.group_offset >= range.first) {
+			// all columns skip the pruned rows at once, so entire pages are skipped without being decompressed
+			auto skip_count = MinValue<idx_t>(range.second, GetGroup(state).num_rows) - state.group_offset;
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+			}
+			state.group_offset += skip_count;
+			result.SetCardinality(0);
+			return true;
+		}
+		// end this chunk at the start of the pruned range
+		this_output_chunk_rows = MinValue<idx_t>(this_output_chunk_rows, range.first - state.group_offset);
+		break;
+	}
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -924,8 +1125,6 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
 	if (reader_data.filters) {
 		vector<bool> need_to_read(reader_data.column_ids.size(), true);
 
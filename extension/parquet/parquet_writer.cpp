@@ -226,8 +226,10 @@ void VerifyUniqueNames(const vector<string> &names) {
 }
 
 ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalType> types_p, vector<string> names_p,
-                             CompressionCodec::type codec)
-    : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec) {
+                             CompressionCodec::type codec, const vector<idx_t> &bloom_filter_columns,
+                             double bloom_filter_fpp, ParquetVersion parquet_version)
+    : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
+      parquet_version(parquet_version) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -259,6 +261,9 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
 		column_writers.push_back(ColumnWriter::CreateWriterRecursive(file_meta_data.schema, *this, sql_types[i],
 		                                                             unique_names[i], schema_path));
 	}
+	for (auto &column_idx : bloom_filter_columns) {
+		column_writers[column_idx]->bloom_filter_fpp = bloom_filter_fpp;
+	}
 }
 
 void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
@@ -286,6 +291,8 @@ void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGro
 		for (auto &chunk : buffer.Chunks()) {
 			col_writer->Write(*write_state, chunk.data[col_idx], chunk.size());
 		}
+		// compress the remaining pages here, so only appending the row group to the file happens under the lock
+		col_writer->FinishWrite(*write_state);
 		states.push_back(std::move(write_state));
 	}
 }
@@ -320,7 +327,47 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::RegisterPageIndex(idx_t column_idx,
+                                      duckdb::unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+                                      duckdb_parquet::format::OffsetIndex offset_index) {
+	// this is called while flushing a row group, which is appended to the file meta data afterwards
+	ParquetPageIndex page_index;
+	page_index.row_group_idx = file_meta_data.row_groups.size();
+	page_index.column_idx = column_idx;
+	page_index.column_index = std::move(column_index);
+	page_index.offset_index = std::move(offset_index);
+	page_indexes.push_back(std::move(page_index));
+}
+
+void ParquetWriter::WritePageIndexes() {
+	// the column indexes of all column chunks are written first, followed by all offset indexes
+	for (auto &page_index : page_indexes) {
+		if (!page_index.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto start_offset = writer->GetTotalWritten();
+		page_index.column_index->write(protocol.get());
+		column_chunk.column_index_offset = start_offset;
+		column_chunk.column_index_length = writer->GetTotalWritten() - start_offset;
+		column_chunk.__isset.column_index_offset = true;
+		column_chunk.__isset.column_index_length = true;
+	}
+	for (auto &page_index : page_indexes) {
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto start_offset = writer->GetTotalWritten();
+		page_index.offset_index.write(protocol.get());
+		column_chunk.offset_index_offset = start_offset;
+		column_chunk.offset_index_length = writer->GetTotalWritten() - start_offset;
+		column_chunk.__isset.offset_index_offset = true;
+		column_chunk.__isset.offset_index_length = true;
+	}
+	page_indexes.clear();
+}
+
 void ParquetWriter::Finalize() {
+	WritePageIndexes();
+
 	auto start_offset = writer->GetTotalWritten();
 	file_meta_data.write(protocol.get());
 
@@ -4,6 +4,7 @@
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/parallel/event.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <numeric>
 
@@ -186,7 +187,7 @@ void PartitionGlobalSinkState::CombineLocalPartition(GroupingPartition &local_pa
 	grouping_data->Combine(*local_partition);
 }
 
-void PartitionGlobalSinkState::BuildSortState(ColumnDataCollection &group_data, PartitionGlobalHashGroup &hash_group) {
+void PartitionGlobalSinkState::BuildSortState(ColumnDataConsumer &group_data, PartitionGlobalHashGroup &hash_group) {
 	auto &global_sort = *hash_group.global_sort;
 
 	//	 Set up the sort expression computation.
@@ -208,20 +209,11 @@ void PartitionGlobalSinkState::BuildSortState(ColumnDataCollection &group_data,
 	DataChunk payload_chunk;
 	payload_chunk.Initialize(allocator, payload_types);
 
-	vector<column_t> column_ids;
-	column_ids.reserve(payload_types.size());
-	for (column_t i = 0; i < payload_types.size(); ++i) {
-		column_ids.emplace_back(i);
-	}
-	ColumnDataConsumer scanner(group_data, column_ids);
+	//	The consumer is shared by all the threads sorting this group
 	ColumnDataConsumerScanState chunk_state;
 	chunk_state.current_chunk_state.properties = ColumnDataScanProperties::ALLOW_ZERO_COPY;
-	scanner.InitializeScan();
-	for (auto chunk_idx = scanner.ChunkCount(); chunk_idx-- > 0;) {
-		if (!scanner.AssignChunk(chunk_state)) {
-			break;
-		}
-		scanner.ScanChunk(chunk_state, payload_chunk);
+	while (group_data.AssignChunk(chunk_state)) {
+		group_data.ScanChunk(chunk_state, payload_chunk);
 
 		sort_chunk.Reset();
 		executor.Execute(payload_chunk, sort_chunk);
@@ -230,12 +222,11 @@ void PartitionGlobalSinkState::BuildSortState(ColumnDataCollection &group_data,
 		if (local_sort.SizeInBytes() > memory_per_thread) {
 			local_sort.Sort(global_sort, true);
 		}
-		scanner.FinishChunk(chunk_state);
+		hash_group.count += payload_chunk.size();
+		group_data.FinishChunk(chunk_state);
 	}
 
 	global_sort.AddLocalState(local_sort);
-
-	hash_group.count += group_data.Count();
 }
 
 //	Per-thread sink state
@@ -352,8 +343,9 @@ void PartitionLocalSinkState::Combine() {
 
 PartitionGlobalMergeState::PartitionGlobalMergeState(PartitionGlobalSinkState &sink, GroupDataPtr group_data,
                                                      hash_t hash_bin)
-    : sink(sink), group_data(std::move(group_data)), stage(PartitionSortStage::INIT), total_tasks(0), tasks_assigned(0),
-      tasks_completed(0) {
+    : sink(sink), group_data(std::move(group_data)),
+      num_threads(TaskScheduler::GetScheduler(sink.context).NumberOfThreads()), stage(PartitionSortStage::INIT),
+      total_tasks(0), tasks_assigned(0), tasks_completed(0) {
 
 	const auto group_idx = sink.hash_groups.size();
 	auto new_group = make_uniq<PartitionGlobalHashGroup>(sink.buffer_manager, sink.partitions, sink.orders,
@@ -364,14 +356,38 @@ PartitionGlobalMergeState::PartitionGlobalMergeState(PartitionGlobalSinkState &s
 	global_sort = sink.hash_groups[group_idx]->global_sort.get();
 
 	sink.bin_groups[hash_bin] = group_idx;
+
+	//	Strip the hash column when scanning
+	vector<column_t> column_ids;
+	column_ids.reserve(sink.payload_types.size());
+	for (column_t i = 0; i < sink.payload_types.size(); ++i) {
+		column_ids.emplace_back(i);
+	}
+	group_consumer = make_uniq<ColumnDataConsumer>(*this->group_data, std::move(column_ids));
+	group_consumer->InitializeScan();
 }
 
-void PartitionLocalMergeState::Prepare() {
-	auto &global_sort = *merge_state->global_sort;
-	merge_state->sink.BuildSortState(*merge_state->group_data, *merge_state->hash_group);
-	merge_state->group_data.reset();
+idx_t PartitionGlobalMergeState::PrepareTaskCount() const {
+	//	Large groups (e.g., a single partition) are sorted by several threads at once,
+	//	but small groups use a single sort run to avoid extra merge rounds
+	const auto group_tasks = MaxValue<idx_t>(group_data->Count() / STANDARD_ROW_GROUPS_SIZE, 1);
+	return MinValue<idx_t>(group_tasks, MaxValue<idx_t>(num_threads, 1));
+}
 
-	global_sort.PrepareMergePhase();
+idx_t PartitionGlobalMergeState::MergeTaskCount() const {
+	//	Merge path lets several threads merge the same pair of blocks,
+	//	so use enough tasks to keep the threads busy when there are only a few pairs
+	const auto pairs = global_sort->sorted_blocks.size() / 2;
+	if (!pairs) {
+		return 0;
+	}
+	const auto block_capacity = MaxValue<idx_t>(global_sort->block_capacity, 1);
+	const auto partitions = (hash_group->count + block_capacity - 1) / block_capacity;
+	return MaxValue<idx_t>(pairs, MinValue<idx_t>(partitions, num_threads));
+}
+
+void PartitionLocalMergeState::Prepare() {
+	merge_state->sink.BuildSortState(*merge_state->group_consumer, *merge_state->hash_group);
 }
 
 void PartitionLocalMergeState::Merge() {
@@ -428,12 +444,16 @@ bool PartitionGlobalMergeState::TryPrepareNextStage() {
 
 	switch (stage) {
 	case PartitionSortStage::INIT:
-		total_tasks = 1;
+		total_tasks = PrepareTaskCount();
 		stage = PartitionSortStage::PREPARE;
 		return true;
 
 	case PartitionSortStage::PREPARE:
-		total_tasks = global_sort->sorted_blocks.size() / 2;
+		group_consumer.reset();
+		group_data.reset();
+		global_sort->PrepareMergePhase();
+
+		total_tasks = MergeTaskCount();
 		if (!total_tasks) {
 			break;
 		}
@@ -443,7 +463,7 @@ bool PartitionGlobalMergeState::TryPrepareNextStage() {
 
 	case PartitionSortStage::MERGE:
 		global_sort->CompleteMergeRound(true);
-		total_tasks = global_sort->sorted_blocks.size() / 2;
+		total_tasks = MergeTaskCount();
 		if (!total_tasks) {
 			break;
 		}
@@ -8,6 +8,7 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/queue.hpp"
 #include "duckdb/common/field_writer.hpp"
+#include "duckdb/execution/merge_sort_tree.hpp"
 
 #include <algorithm>
 #include <stdlib.h>
@@ -51,6 +52,12 @@ struct QuantileState {
 	// Windowed MAD indirection
 	vector<idx_t> m;
 
+	// Windowed Quantile merge sort trees
+	using QuantileSortTree32 = MergeSortTree<uint32_t>;
+	using QuantileSortTree64 = MergeSortTree<uint64_t>;
+	unique_ptr<QuantileSortTree32> qst32;
+	unique_ptr<QuantileSortTree64> qst64;
+
 	QuantileState() : pos(0) {
 	}
 
@@ -63,6 +70,26 @@ struct QuantileState {
 			w.resize(pos);
 		}
 	}
+
+	inline bool HasTree() const {
+		return qst32 || qst64;
+	}
+
+	//! The number of included values in the frame
+	inline idx_t WindowCount(const FrameBounds &frame) const {
+		if (qst32) {
+			return qst32->CountRange(uint32_t(frame.first), uint32_t(frame.second));
+		}
+		return qst64->CountRange(frame.first, frame.second);
+	}
+
+	//! The row index of the n-th smallest included value in the frame
+	inline idx_t WindowSelect(const FrameBounds &frame, idx_t n) const {
+		if (qst32) {
+			return qst32->SelectNth(uint32_t(frame.first), uint32_t(frame.second), n);
+		}
+		return qst64->SelectNth(frame.first, frame.second, n);
+	}
 };
 
 struct QuantileIncluded {
@@ -325,6 +352,19 @@ struct Interpolator {
 		}
 	}
 
+	//! Interpolates between the FRN-th and CRN-th elements, which have already been selected into dest
+	template <class INPUT_TYPE, class TARGET_TYPE, typename ACCESSOR = QuantileDirect<INPUT_TYPE>>
+	TARGET_TYPE Extract(const INPUT_TYPE *dest, Vector &result, const ACCESSOR &accessor = ACCESSOR()) const {
+		using ACCESS_TYPE = typename ACCESSOR::RESULT_TYPE;
+		if (CRN == FRN) {
+			return CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(dest[0]), result);
+		} else {
+			auto lo = CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(dest[0]), result);
+			auto hi = CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(dest[1]), result);
+			return CastInterpolation::Interpolate<TARGET_TYPE>(lo, RN - FRN, hi);
+		}
+	}
+
 	const bool desc;
 	const double RN;
 	const idx_t FRN;
@@ -377,6 +417,12 @@ struct Interpolator<true> {
 		return CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(v_t[FRN]), result);
 	}
 
+	template <class INPUT_TYPE, class TARGET_TYPE, typename ACCESSOR = QuantileDirect<INPUT_TYPE>>
+	TARGET_TYPE Extract(const INPUT_TYPE *dest, Vector &result, const ACCESSOR &accessor = ACCESSOR()) const {
+		using ACCESS_TYPE = typename ACCESSOR::RESULT_TYPE;
+		return CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(dest[0]), result);
+	}
+
 	const bool desc;
 	const idx_t FRN;
 	const idx_t CRN;
@@ -461,12 +507,40 @@ struct QuantileBindData : public FunctionData {
 	bool desc;
 };
 
+template <typename IDX, typename INPUT_TYPE>
+static unique_ptr<MergeSortTree<IDX>> BuildQuantileSortTree(const INPUT_TYPE *data, const QuantileIncluded &included,
+                                                            idx_t count) {
+	//	The lowest level contains the row indexes of the included values, ordered by value
+	vector<IDX> index;
+	index.reserve(count);
+	for (idx_t i = 0; i < count; ++i) {
+		if (included(i)) {
+			index.emplace_back(IDX(i));
+		}
+	}
+	IndirectLess<INPUT_TYPE> lt(data);
+	std::sort(index.begin(), index.end(), lt);
+
+	return make_uniq<MergeSortTree<IDX>>(std::move(index));
+}
+
 struct QuantileOperation {
 	template <class STATE>
 	static void Initialize(STATE &state) {
 		new (&state) STATE();
 	}
 
+	template <class STATE, class INPUT_TYPE>
+	static void WindowInit(const INPUT_TYPE *data, const ValidityMask &fmask, const ValidityMask &dmask,
+	                       AggregateInputData &aggr_input_data, STATE &state, idx_t count) {
+		QuantileIncluded included(fmask, dmask, 0);
+		if (count < NumericLimits<uint32_t>::Maximum()) {
+			state.qst32 = BuildQuantileSortTree<uint32_t>(data, included, count);
+		} else {
+			state.qst64 = BuildQuantileSortTree<uint64_t>(data, included, count);
+		}
+	}
+
 	template <class INPUT_TYPE, class STATE, class OP>
 	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
 	                              idx_t count) {
@@ -531,6 +605,30 @@ struct QuantileScalarOperation : public QuantileOperation {
 		auto rdata = FlatVector::GetData<RESULT_TYPE>(result);
 		auto &rmask = FlatVector::Validity(result);
 
+		D_ASSERT(aggr_input_data.bind_data);
+		auto &bind_data = aggr_input_data.bind_data->Cast<QuantileBindData>();
+
+		// Find the two positions needed
+		const auto q = bind_data.quantiles[0];
+
+		using ID = QuantileIndirect<INPUT_TYPE>;
+		ID indirect(data);
+
+		//	If we have a merge sort tree, select the two positions directly
+		if (state.HasTree()) {
+			const auto n = state.WindowCount(frame);
+			if (n) {
+				Interpolator<DISCRETE> interp(q, n, false);
+				idx_t dest[2];
+				dest[0] = state.WindowSelect(frame, interp.FRN);
+				dest[1] = (interp.CRN == interp.FRN) ? dest[0] : state.WindowSelect(frame, interp.CRN);
+				rdata[ridx] = interp.template Extract<idx_t, RESULT_TYPE, ID>(dest, result, indirect);
+			} else {
+				rmask.Set(ridx, false);
+			}
+			return;
+		}
+
 		QuantileIncluded included(fmask, dmask, bias);
 
 		//  Lazily initialise frame state
@@ -540,12 +638,6 @@ struct QuantileScalarOperation : public QuantileOperation {
 		auto index = state.w.data();
 		D_ASSERT(index);
 
-		D_ASSERT(aggr_input_data.bind_data);
-		auto &bind_data = aggr_input_data.bind_data->Cast<QuantileBindData>();
-
-		// Find the two positions needed
-		const auto q = bind_data.quantiles[0];
-
 		bool replace = false;
 		if (frame.first == prev.first + 1 && frame.second == prev.second + 1) {
 			//  Fixed frame size
@@ -569,8 +661,6 @@ struct QuantileScalarOperation : public QuantileOperation {
 		if (state.pos) {
 			Interpolator<DISCRETE> interp(q, state.pos, false);
 
-			using ID = QuantileIndirect<INPUT_TYPE>;
-			ID indirect(data);
 			rdata[ridx] = replace ? interp.template Replace<idx_t, RESULT_TYPE, ID>(index, result, indirect)
 			                      : interp.template Operation<idx_t, RESULT_TYPE, ID>(index, result, indirect);
 		} else {
@@ -585,6 +675,7 @@ AggregateFunction GetTypedDiscreteQuantileAggregateFunction(const LogicalType &t
 	using OP = QuantileScalarOperation<true>;
 	auto fun = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP>(type, type);
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, INPUT_TYPE, OP>;
+	fun.window_init = AggregateFunction::UnaryWindowInit<STATE, INPUT_TYPE, OP>;
 	return fun;
 }
 
@@ -693,6 +784,27 @@ struct QuantileListOperation : public QuantileOperation {
 		auto &result = ListVector::GetEntry(list);
 		auto rdata = FlatVector::GetData<CHILD_TYPE>(result);
 
+		using ID = QuantileIndirect<INPUT_TYPE>;
+		ID indirect(data);
+
+		//	If we have a merge sort tree, select the positions for each quantile directly
+		if (state.HasTree()) {
+			const auto n = state.WindowCount(frame);
+			if (n) {
+				for (const auto &q : bind_data.order) {
+					const auto &quantile = bind_data.quantiles[q];
+					Interpolator<DISCRETE> interp(quantile, n, false);
+					idx_t dest[2];
+					dest[0] = state.WindowSelect(frame, interp.FRN);
+					dest[1] = (interp.CRN == interp.FRN) ? dest[0] : state.WindowSelect(frame, interp.CRN);
+					rdata[lentry.offset + q] = interp.template Extract<idx_t, CHILD_TYPE, ID>(dest, result, indirect);
+				}
+			} else {
+				lmask.Set(lidx, false);
+			}
+			return;
+		}
+
 		//  Lazily initialise frame state
 		auto prev_pos = state.pos;
 		state.SetPos(frame.second - frame.first);
@@ -740,8 +852,6 @@ struct QuantileListOperation : public QuantileOperation {
 		}
 
 		if (state.pos) {
-			using ID = QuantileIndirect<INPUT_TYPE>;
-			ID indirect(data);
 			for (const auto &q : bind_data.order) {
 				const auto &quantile = bind_data.quantiles[q];
 				Interpolator<DISCRETE> interp(quantile, state.pos, false);
@@ -774,6 +884,7 @@ AggregateFunction GetTypedDiscreteQuantileListAggregateFunction(const LogicalTyp
 	auto fun = QuantileListAggregate<STATE, INPUT_TYPE, list_entry_t, OP>(type, type);
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
+	fun.window_init = AggregateFunction::UnaryWindowInit<STATE, INPUT_TYPE, OP>;
 	return fun;
 }
 
@@ -831,6 +942,7 @@ AggregateFunction GetTypedContinuousQuantileAggregateFunction(const LogicalType
 	auto fun = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, TARGET_TYPE, OP>(input_type, target_type);
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, TARGET_TYPE, OP>;
+	fun.window_init = AggregateFunction::UnaryWindowInit<STATE, INPUT_TYPE, OP>;
 	return fun;
 }
 
@@ -885,6 +997,7 @@ AggregateFunction GetTypedContinuousQuantileListAggregateFunction(const LogicalT
 	auto fun = QuantileListAggregate<STATE, INPUT_TYPE, list_entry_t, OP>(input_type, result_type);
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
+	fun.window_init = AggregateFunction::UnaryWindowInit<STATE, INPUT_TYPE, OP>;
 	return fun;
 }
 
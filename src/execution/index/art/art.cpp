@@ -32,6 +32,8 @@ struct ARTIndexScanState : public IndexScanState {
 	//! All scanned row IDs
 	vector<row_t> result_ids;
 	Iterator iterator;
+	//! The key at which an ordered scan continues (empty if the scan has not started yet)
+	vector<data_t> next_key;
 };
 
 ART::ART(const vector<column_t> &column_ids, TableIOManager &table_io_manager,
@@ -115,6 +117,19 @@ unique_ptr<IndexScanState> ART::InitializeScanTwoPredicates(const Transaction &t
 	return std::move(result);
 }
 
+unique_ptr<IndexScanState> ART::InitializeOrderedScan(const Transaction &transaction, const Value &low_value,
+                                                      const ExpressionType low_expression_type,
+                                                      const Value &high_value,
+                                                      const ExpressionType high_expression_type) {
+	// initialize ordered scan
+	auto result = make_uniq<ARTIndexScanState>();
+	result->values[0] = low_value;
+	result->expressions[0] = low_expression_type;
+	result->values[1] = high_value;
+	result->expressions[1] = high_expression_type;
+	return std::move(result);
+}
+
 //===--------------------------------------------------------------------===//
 // Keys
 //===--------------------------------------------------------------------===//
@@ -347,7 +362,17 @@ bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_ide
 
 	auto key_section = KeySection(0, count - 1, 0, 0);
 	auto has_constraint = IsUnique();
-	return Construct(*this, keys, row_ids, *this->tree, key_section, has_constraint);
+	if (!tree->IsSet()) {
+		return Construct(*this, keys, row_ids, *this->tree, key_section, has_constraint);
+	}
+
+	// the subtree uses the node storage of this ART, so (unlike MergeIndexes) we do not need to traverse it
+	// to update its buffer IDs before merging it into the tree
+	Node subtree;
+	if (!Construct(*this, keys, row_ids, subtree, key_section, has_constraint)) {
+		return false;
+	}
+	return tree->Merge(*this, subtree);
 }
 
 //===--------------------------------------------------------------------===//
@@ -851,6 +876,52 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 	return true;
 }
 
+bool ART::ScanOrdered(const Transaction &transaction, const DataTable &table, IndexScanState &table_state,
+                      const idx_t max_count, vector<row_t> &result_ids) {
+	auto &state = table_state.Cast<ARTIndexScanState>();
+
+	ArenaAllocator arena_allocator(Allocator::Get(db));
+	ARTKey upper_bound;
+	if (!state.values[1].IsNull()) {
+		D_ASSERT(state.values[1].type().InternalType() == types[0]);
+		upper_bound = CreateKey(arena_allocator, types[0], state.values[1]);
+	}
+	bool right_inclusive = state.expressions[1] == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+
+	lock_guard<mutex> l(lock);
+
+	// the tree might have changed since the previous call, so we position a new iterator at the next key
+	Iterator it;
+	it.art = this;
+	if (!state.next_key.empty()) {
+		ARTKey next_key(state.next_key.data(), state.next_key.size());
+		if (!it.LowerBound(*tree, next_key, true)) {
+			return false;
+		}
+	} else if (!state.values[0].IsNull()) {
+		D_ASSERT(state.values[0].type().InternalType() == types[0]);
+		auto lower_bound = CreateKey(arena_allocator, types[0], state.values[0]);
+		bool left_inclusive = state.expressions[0] == ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+		if (!it.LowerBound(*tree, lower_bound, left_inclusive)) {
+			return false;
+		}
+	} else {
+		if (!tree->IsSet()) {
+			return false;
+		}
+		it.FindMinimum(*tree);
+	}
+
+	// always add the row IDs of the first key, even if they exceed the max count
+	auto count = MaxValue<idx_t>(max_count, result_ids.size() + it.GetLeafCount());
+	if (it.Scan(upper_bound, count, result_ids, right_inclusive)) {
+		return false;
+	}
+	// the iterator stopped at a key that did not fit: continue at that key in the next call
+	it.cur_key.Copy(state.next_key);
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // More Verification / Constraint Checking
 //===--------------------------------------------------------------------===//
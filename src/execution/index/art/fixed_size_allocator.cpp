@@ -131,6 +131,10 @@ bool FixedSizeAllocator::InitializeVacuum() {
 
 	// vacuum_count buffers can be freed
 	auto vacuum_count = total_free_positions / allocations_per_buffer / 2;
+	if (vacuum_count == 0) {
+		// nothing to free (this also covers allocators without any buffers)
+		return false;
+	}
 
 	// calculate the vacuum threshold adaptively
 	idx_t memory_usage = GetMemoryUsage();
@@ -62,6 +62,10 @@ bool IteratorCurrentKey::operator==(const ARTKey &k) const {
 	return true;
 }
 
+void IteratorCurrentKey::Copy(vector<data_t> &result) const {
+	result.assign(key.begin(), key.begin() + cur_key_pos);
+}
+
 void Iterator::FindMinimum(Node &node) {
 
 	// reconstruct the prefix
@@ -88,12 +92,6 @@ void Iterator::FindMinimum(Node &node) {
 	FindMinimum(*next);
 }
 
-void Iterator::PushKey(const Node &node, const uint8_t byte) {
-	if (node.DecodeARTNodeType() != NType::LEAF) {
-		cur_key.Push(byte);
-	}
-}
-
 bool Iterator::Scan(const ARTKey &key, const idx_t &max_count, vector<row_t> &result_ids, const bool &is_inclusive) {
 
 	bool has_next;
@@ -130,64 +128,49 @@ bool Iterator::Scan(const ARTKey &key, const idx_t &max_count, vector<row_t> &re
 	return true;
 }
 
+idx_t Iterator::GetLeafCount() const {
+	D_ASSERT(last_leaf);
+	return last_leaf->count;
+}
+
 void Iterator::PopNode() {
-	auto cur_node = nodes.top();
-	idx_t elements_to_pop = cur_node.node.GetPrefix(*art).count + (nodes.size() != 1);
-	cur_key.Pop(elements_to_pop);
+	// pop the prefix of the node and the byte of the child we descended into
+	auto &top = nodes.top();
+	cur_key.Pop(top.node.GetPrefix(*art).count + 1);
 	nodes.pop();
 }
 
 bool Iterator::Next() {
-	if (!nodes.empty()) {
-		auto cur_node = nodes.top().node;
-		if (cur_node.DecodeARTNodeType() == NType::LEAF) {
-			// pop leaf
-			// we must pop the prefix size + the key to the node, unless we are popping the root
-			PopNode();
-		}
-	}
+	// pop the prefix of the current leaf
+	cur_key.Pop(last_leaf->prefix.count);
+	return FindNextLeaf();
+}
 
-	// look for the next leaf
+bool Iterator::FindNextLeaf() {
 	while (!nodes.empty()) {
-
-		// cur_node
 		auto &top = nodes.top();
-		Node node = top.node;
+		D_ASSERT(top.node.DecodeARTNodeType() != NType::LEAF);
 
-		// found a leaf: move to next node
-		if (node.DecodeARTNodeType() == NType::LEAF) {
-			last_leaf = Node::GetAllocator(*art, NType::LEAF).Get<Leaf>(node);
-			return true;
-		}
-
-		// find next node
 		if (top.byte == NumericLimits<uint8_t>::Maximum()) {
-			// no node found: move up the tree, pop prefix and key of current node
+			// all children visited: move up the tree
 			PopNode();
 			continue;
 		}
 
-		top.byte == 0 ? top.byte : top.byte++;
-		auto next_node = node.GetNextChild(*art, top.byte);
-
-		if (next_node) {
-			// add the next node's key byte
-			PushKey(node, top.byte);
-
-			// add prefix of new node
-			// FIXME: get all bytes at once to increase performance
-			auto &next_node_prefix = next_node->GetPrefix(*art);
-			for (idx_t i = 0; i < next_node_prefix.count; i++) {
-				cur_key.Push(next_node_prefix.GetByte(*art, i));
-			}
-
-			// next node found: push it
-			nodes.emplace(*next_node, 0);
-		} else {
-
-			// no node found: move up the tree, pop prefix and key of current node
+		// find the next child of the node
+		top.byte++;
+		auto next_node = top.node.GetNextChild(*art, top.byte);
+		if (!next_node) {
+			// all children visited: move up the tree
 			PopNode();
+			continue;
 		}
+
+		// replace the byte of the previous child, and descend to the leftmost leaf of the next child
+		cur_key.Pop(1);
+		cur_key.Push(top.byte);
+		FindMinimum(*next_node);
+		return true;
 	}
 	return false;
 }
@@ -199,101 +182,59 @@ bool Iterator::LowerBound(Node node, const ARTKey &key, const bool &is_inclusive
 	}
 
 	idx_t depth = 0;
-	bool equal = true;
 	while (true) {
-
-		nodes.emplace(node, 0);
-		auto &top = nodes.top();
-
-		// reconstruct the prefix
-		// FIXME: get all bytes at once to increase performance
-		reference<Prefix> node_prefix(top.node.GetPrefix(*art));
-		for (idx_t i = 0; i < node_prefix.get().count; i++) {
-			cur_key.Push(node_prefix.get().GetByte(*art, i));
-		}
-
-		// greater case: find leftmost leaf node directly
-		if (!equal) {
-			while (node.DecodeARTNodeType() != NType::LEAF) {
-
-				uint8_t byte = 0;
-				auto next_node = *node.GetNextChild(*art, byte);
-				D_ASSERT(next_node.IsSet());
-
-				PushKey(node, byte);
-				nodes.emplace(node, byte);
-				node = next_node;
-
-				// reconstruct the prefix
-				node_prefix = node.GetPrefix(*art);
-				for (idx_t i = 0; i < node_prefix.get().count; i++) {
-					cur_key.Push(node_prefix.get().GetByte(*art, i));
-				}
-
-				auto &c_top = nodes.top();
-				c_top.node = node;
-			}
-		}
+		auto &node_prefix = node.GetPrefix(*art);
 
 		if (node.DecodeARTNodeType() == NType::LEAF) {
-			// found a leaf node: check if it is bigger or equal than the current key
-			last_leaf = Node::GetAllocator(*art, NType::LEAF).Get<Leaf>(node);
-
-			// if the search is not inclusive the leaf node could still be equal to the current value
-			// check if leaf is equal to the current key
-			if (cur_key == key) {
-				// if it's not inclusive check if there is a next leaf
-				if (!is_inclusive && !Next()) {
-					return false;
-				} else {
-					return true;
-				}
+			// reconstruct the prefix
+			// FIXME: get all bytes at once to increase performance
+			for (idx_t i = 0; i < node_prefix.count; i++) {
+				cur_key.Push(node_prefix.GetByte(*art, i));
 			}
+			last_leaf = Node::GetAllocator(*art, NType::LEAF).Get<Leaf>(node);
 
-			if (cur_key > key) {
+			// found a leaf node: check if it is bigger (or equal) than the key, otherwise move to the next leaf
+			if (cur_key > key || (is_inclusive && cur_key == key)) {
 				return true;
 			}
-			// Case1: When the ART has only one leaf node, the Next() will return false
-			// Case2: This means the previous node prefix(if any) + a_key(one element of of key array of previous node)
-			// == key[q..=w].
-			// But key[w+1..=z] maybe greater than leaf node prefix.
-			// One fact is key[w] is alawys equal to a_key and the next element
-			// of key array of previous node is always > a_key So we just call Next() once.
-
 			return Next();
 		}
 
-		// equal case:
-		node_prefix = node.GetPrefix(*art);
-		auto mismatch_pos = node_prefix.get().KeyMismatchPosition(*art, key, depth);
-		if (mismatch_pos != node_prefix.get().count) {
-			if (node_prefix.get().GetByte(*art, mismatch_pos) < key[depth + mismatch_pos]) {
-				// less
-				PopNode();
-				return Next();
+		auto mismatch_pos = node_prefix.KeyMismatchPosition(*art, key, depth);
+		if (mismatch_pos != node_prefix.count) {
+			if (node_prefix.GetByte(*art, mismatch_pos) < key[depth + mismatch_pos]) {
+				// all keys in this subtree are less than the key
+				return FindNextLeaf();
 			}
-			// greater
-			top.byte = 0;
-			return Next();
+			// all keys in this subtree are greater than the key
+			FindMinimum(node);
+			return true;
 		}
 
 		// prefix matches, search inside the child for the key
-		depth += node_prefix.get().count;
-		top.byte = key[depth];
-		auto child = node.GetNextChild(*art, top.byte);
-		equal = key[depth] == top.byte;
+		// FIXME: get all bytes at once to increase performance
+		for (idx_t i = 0; i < node_prefix.count; i++) {
+			cur_key.Push(node_prefix.GetByte(*art, i));
+		}
+		depth += node_prefix.count;
 
-		// the maximum key byte of the current node is less than the key
-		// fall back to the previous node
+		uint8_t byte = key[depth];
+		auto child = node.GetNextChild(*art, byte);
 		if (!child) {
-			PopNode();
-			return Next();
+			// the maximum key byte of the current node is less than the key
+			cur_key.Pop(node_prefix.count);
+			return FindNextLeaf();
 		}
 
-		PushKey(node, top.byte);
-		node = *child;
+		cur_key.Push(byte);
+		nodes.emplace(node, byte);
+		if (byte != key[depth]) {
+			// all keys of the child are greater than the key
+			FindMinimum(*child);
+			return true;
+		}
 
-		// all children of this node qualify as greater or equal
+		node = *child;
 		depth++;
 	}
 }
@@ -2,6 +2,8 @@
 
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
@@ -17,6 +19,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/interrupt.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
 
@@ -234,7 +237,7 @@ struct WindowInputColumn {
 		}
 	}
 
-	inline bool CellIsNull(idx_t i) {
+	inline bool CellIsNull(idx_t i) const {
 		D_ASSERT(target);
 		D_ASSERT(i < count);
 		return FlatVector::IsNull(*target, input_expr.scalar ? 0 : i);
@@ -283,10 +286,16 @@ struct WindowBoundariesState {
 	      needs_peer(BoundaryNeedsPeer(wexpr.end) || wexpr.type == ExpressionType::WINDOW_CUME_DIST) {
 	}
 
-	void Update(const idx_t row_idx, WindowInputColumn &range_collection, const idx_t source_offset,
+	void Update(const idx_t row_idx, const WindowInputColumn &range_collection, const idx_t source_offset,
 	            WindowInputExpression &boundary_start, WindowInputExpression &boundary_end,
 	            const ValidityMask &partition_mask, const ValidityMask &order_mask);
 
+	//! Start the next update in the middle of the partition beginning at partition_begin
+	void Seek(const idx_t partition_begin) {
+		partition_start = partition_begin;
+		is_jump = true;
+	}
+
 	// Cached lookups
 	const ExpressionType type;
 	const idx_t input_size;
@@ -309,6 +318,7 @@ struct WindowBoundariesState {
 	int64_t window_end = -1;
 	bool is_same_partition = false;
 	bool is_peer = false;
+	bool is_jump = false;
 };
 
 static bool WindowNeedsRank(const BoundWindowExpression &wexpr) {
@@ -317,20 +327,20 @@ static bool WindowNeedsRank(const BoundWindowExpression &wexpr) {
 }
 
 template <typename T>
-static T GetCell(DataChunk &chunk, idx_t column, idx_t index) {
+static T GetCell(const DataChunk &chunk, idx_t column, idx_t index) {
 	D_ASSERT(chunk.ColumnCount() > column);
 	auto &source = chunk.data[column];
 	const auto data = FlatVector::GetData<T>(source);
 	return data[index];
 }
 
-static bool CellIsNull(DataChunk &chunk, idx_t column, idx_t index) {
+static bool CellIsNull(const DataChunk &chunk, idx_t column, idx_t index) {
 	D_ASSERT(chunk.ColumnCount() > column);
 	auto &source = chunk.data[column];
 	return FlatVector::IsNull(source, index);
 }
 
-static void CopyCell(DataChunk &chunk, idx_t column, idx_t index, Vector &target, idx_t target_offset) {
+static void CopyCell(const DataChunk &chunk, idx_t column, idx_t index, Vector &target, idx_t target_offset) {
 	D_ASSERT(chunk.ColumnCount() > column);
 	auto &source = chunk.data[column];
 	VectorOperations::Copy(source, target, index + 1, index, target_offset);
@@ -345,7 +355,7 @@ struct WindowColumnIterator {
 	using reference = T;
 	using pointer = idx_t;
 
-	explicit WindowColumnIterator(WindowInputColumn &coll_p, pointer pos_p = 0) : coll(&coll_p), pos(pos_p) {
+	explicit WindowColumnIterator(const WindowInputColumn &coll_p, pointer pos_p = 0) : coll(&coll_p), pos(pos_p) {
 	}
 
 	inline reference operator*() const {
@@ -373,7 +383,7 @@ struct WindowColumnIterator {
 	}
 
 private:
-	optional_ptr<WindowInputColumn> coll;
+	optional_ptr<const WindowInputColumn> coll;
 	pointer pos;
 };
 
@@ -385,7 +395,7 @@ struct OperationCompare : public std::function<bool(T, T)> {
 };
 
 template <typename T, typename OP, bool FROM>
-static idx_t FindTypedRangeBound(WindowInputColumn &over, const idx_t order_begin, const idx_t order_end,
+static idx_t FindTypedRangeBound(const WindowInputColumn &over, const idx_t order_begin, const idx_t order_end,
                                  WindowInputExpression &boundary, const idx_t boundary_row) {
 	D_ASSERT(!boundary.CellIsNull(boundary_row));
 	const auto val = boundary.GetCell<T>(boundary_row);
@@ -401,7 +411,7 @@ static idx_t FindTypedRangeBound(WindowInputColumn &over, const idx_t order_begi
 }
 
 template <typename OP, bool FROM>
-static idx_t FindRangeBound(WindowInputColumn &over, const idx_t order_begin, const idx_t order_end,
+static idx_t FindRangeBound(const WindowInputColumn &over, const idx_t order_begin, const idx_t order_end,
                             WindowInputExpression &boundary, const idx_t expr_idx) {
 	D_ASSERT(boundary.chunk.ColumnCount() == 1);
 	D_ASSERT(boundary.chunk.data[0].GetType().InternalType() == over.input_expr.ptype);
@@ -437,7 +447,7 @@ static idx_t FindRangeBound(WindowInputColumn &over, const idx_t order_begin, co
 }
 
 template <bool FROM>
-static idx_t FindOrderedRangeBound(WindowInputColumn &over, const OrderType range_sense, const idx_t order_begin,
+static idx_t FindOrderedRangeBound(const WindowInputColumn &over, const OrderType range_sense, const idx_t order_begin,
                                    const idx_t order_end, WindowInputExpression &boundary, const idx_t expr_idx) {
 	switch (range_sense) {
 	case OrderType::ASCENDING:
@@ -449,7 +459,7 @@ static idx_t FindOrderedRangeBound(WindowInputColumn &over, const OrderType rang
 	}
 }
 
-void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range_collection, const idx_t expr_idx,
+void WindowBoundariesState::Update(const idx_t row_idx, const WindowInputColumn &range_collection, const idx_t expr_idx,
                                    WindowInputExpression &boundary_start, WindowInputExpression &boundary_end,
                                    const ValidityMask &partition_mask, const ValidityMask &order_mask) {
 
@@ -460,10 +470,15 @@ void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range
 		bounds.is_same_partition = !partition_mask.RowIsValidUnsafe(row_idx);
 		bounds.is_peer = !order_mask.RowIsValidUnsafe(row_idx);
 
-		// when the partition changes, recompute the boundaries
-		if (!bounds.is_same_partition) {
-			bounds.partition_start = row_idx;
-			bounds.peer_start = row_idx;
+		// when the partition changes (or we jump into the middle of one), recompute the boundaries
+		if (!bounds.is_same_partition || bounds.is_jump) {
+			if (!bounds.is_same_partition) {
+				bounds.partition_start = row_idx;
+				bounds.peer_start = row_idx;
+			} else {
+				idx_t n = 1;
+				bounds.peer_start = FindPrevStart(order_mask, bounds.partition_start, row_idx + 1, n);
+			}
 
 			// find end of partition
 			bounds.partition_end = bounds.input_size;
@@ -511,6 +526,7 @@ void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range
 		bounds.partition_end = bounds.input_size;
 		bounds.peer_end = bounds.partition_end;
 	}
+	bounds.is_jump = false;
 
 	// determine window boundaries depending on the type of expression
 	bounds.window_start = -1;
@@ -613,26 +629,30 @@ void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range
 	}
 }
 
+struct WindowExecutorState;
+
+//! The shared state of a window function over a hash group.
+//! It is built by a single thread (Sink and Finalize) and then evaluated by many (Evaluate).
 struct WindowExecutor {
 	static bool IsConstantAggregate(const BoundWindowExpression &wexpr);
 
 	WindowExecutor(BoundWindowExpression &wexpr, ClientContext &context, const ValidityMask &partition_mask,
-	               const idx_t count);
+	               const ValidityMask &order_mask, const idx_t count);
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count);
 	void Finalize(WindowAggregationMode mode);
 
-	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, const ValidityMask &partition_mask,
-	              const ValidityMask &order_mask);
+	unique_ptr<WindowExecutorState> GetLocalState(ClientContext &context) const;
+	void Evaluate(WindowExecutorState &lstate, idx_t row_idx, DataChunk &input_chunk, Vector &result,
+	              const ValidityMask &partition_mask, const ValidityMask &order_mask) const;
+
+	//! The number of peer groups starting in [0, row_idx), used to seek DENSE_RANK
+	idx_t CountPeers(const ValidityMask &order_mask, idx_t row_idx) const;
 
 	// The function
 	BoundWindowExpression &wexpr;
-
-	// Frame management
-	WindowBoundariesState bounds;
-	uint64_t dense_rank = 1;
-	uint64_t rank_equal = 0;
-	uint64_t rank = 1;
+	//! The number of rows in the hash group
+	const idx_t count;
 
 	// Expression collections
 	DataChunk payload_collection;
@@ -644,26 +664,46 @@ struct WindowExecutor {
 	vector<validity_t> filter_bits;
 	SelectionVector filter_sel;
 
-	// LEAD/LAG Evaluation
-	WindowInputExpression leadlag_offset;
-	WindowInputExpression leadlag_default;
-
-	// evaluate boundaries if present. Parser has checked boundary types.
-	WindowInputExpression boundary_start;
-	WindowInputExpression boundary_end;
-
 	// evaluate RANGE expressions, if needed
 	WindowInputColumn range;
 
 	// IGNORE NULLS
 	ValidityMask ignore_nulls;
 
+	// DENSE_RANK peer counts at the start of each vector
+	vector<idx_t> peer_counts;
+
 	// build a segment tree for frame-adhering aggregates
 	// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
 	unique_ptr<WindowSegmentTree> segment_tree = nullptr;
 
 	// all aggregate values are the same for each partition
 	unique_ptr<WindowConstantAggregate> constant_aggregate = nullptr;
+
+	// DISTINCT aggregates over the first occurrence of each value in the frame
+	unique_ptr<WindowDistinctAggregate> distinct_aggregate = nullptr;
+};
+
+//! The thread-local state used to evaluate a window function over ranges of rows
+struct WindowExecutorState {
+	WindowExecutorState(const WindowExecutor &executor, ClientContext &context);
+
+	// Frame management
+	WindowBoundariesState bounds;
+	uint64_t dense_rank = 1;
+	uint64_t rank_equal = 0;
+	uint64_t rank = 1;
+
+	// LEAD/LAG Evaluation
+	WindowInputExpression leadlag_offset;
+	WindowInputExpression leadlag_default;
+
+	// evaluate boundaries if present. Parser has checked boundary types.
+	WindowInputExpression boundary_start;
+	WindowInputExpression boundary_end;
+
+	// scratch space for computing aggregates
+	unique_ptr<WindowAggregateLocalState> aggregate_state;
 };
 
 bool WindowExecutor::IsConstantAggregate(const BoundWindowExpression &wexpr) {
@@ -676,6 +716,11 @@ bool WindowExecutor::IsConstantAggregate(const BoundWindowExpression &wexpr) {
 		return false;
 	}
 
+	//	DISTINCT aggregates need to see the values of each frame.
+	if (wexpr.distinct) {
+		return false;
+	}
+
 	/*
 	    The default framing option is RANGE UNBOUNDED PRECEDING, which
 	    is the same as RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT
@@ -721,11 +766,12 @@ bool WindowExecutor::IsConstantAggregate(const BoundWindowExpression &wexpr) {
 }
 
 WindowExecutor::WindowExecutor(BoundWindowExpression &wexpr, ClientContext &context, const ValidityMask &partition_mask,
-                               const idx_t count)
-    : wexpr(wexpr), bounds(wexpr, count), payload_collection(), payload_executor(context), filter_executor(context),
-      leadlag_offset(wexpr.offset_expr.get(), context), leadlag_default(wexpr.default_expr.get(), context),
-      boundary_start(wexpr.start_expr.get(), context), boundary_end(wexpr.end_expr.get(), context),
-      range((bounds.has_preceding_range || bounds.has_following_range) ? wexpr.orders[0].expression.get() : nullptr,
+                               const ValidityMask &order_mask, const idx_t count)
+    : wexpr(wexpr), count(count), payload_collection(), payload_executor(context), filter_executor(context),
+      range((wexpr.start == WindowBoundary::EXPR_PRECEDING_RANGE || wexpr.end == WindowBoundary::EXPR_PRECEDING_RANGE ||
+             wexpr.start == WindowBoundary::EXPR_FOLLOWING_RANGE || wexpr.end == WindowBoundary::EXPR_FOLLOWING_RANGE)
+                ? wexpr.orders[0].expression.get()
+                : nullptr,
             context, count)
 
 {
@@ -755,6 +801,52 @@ WindowExecutor::WindowExecutor(BoundWindowExpression &wexpr, ClientContext &cont
 	if (!types.empty()) {
 		payload_collection.Initialize(Allocator::Get(context), types);
 	}
+
+	if (wexpr.aggregate && wexpr.distinct && !types.empty()) {
+		distinct_aggregate = make_uniq<WindowDistinctAggregate>(AggregateObject(wexpr), wexpr.return_type, context,
+		                                                        &payload_collection, filter_mask,
+		                                                        DBConfig::GetConfig(context).options.window_mode);
+	}
+
+	// DENSE_RANK can't be computed from the boundaries when evaluation starts in the middle of a partition,
+	// so count the peer groups before each vector
+	if (wexpr.type == ExpressionType::WINDOW_RANK_DENSE) {
+		idx_t peers = 0;
+		for (idx_t begin = 0; begin < count; begin += STANDARD_VECTOR_SIZE) {
+			peer_counts.emplace_back(peers);
+			const auto end = MinValue<idx_t>(begin + STANDARD_VECTOR_SIZE, count);
+			for (auto i = begin; i < end; ++i) {
+				peers += order_mask.RowIsValid(i);
+			}
+		}
+		peer_counts.emplace_back(peers);
+	}
+}
+
+idx_t WindowExecutor::CountPeers(const ValidityMask &order_mask, idx_t row_idx) const {
+	const auto vector_idx = row_idx / STANDARD_VECTOR_SIZE;
+	auto peers = peer_counts[vector_idx];
+	for (auto i = vector_idx * STANDARD_VECTOR_SIZE; i < row_idx; ++i) {
+		peers += order_mask.RowIsValid(i);
+	}
+	return peers;
+}
+
+WindowExecutorState::WindowExecutorState(const WindowExecutor &executor, ClientContext &context)
+    : bounds(executor.wexpr, executor.count), leadlag_offset(executor.wexpr.offset_expr.get(), context),
+      leadlag_default(executor.wexpr.default_expr.get(), context),
+      boundary_start(executor.wexpr.start_expr.get(), context), boundary_end(executor.wexpr.end_expr.get(), context) {
+	if (executor.constant_aggregate) {
+		aggregate_state = executor.constant_aggregate->GetLocalState();
+	} else if (executor.distinct_aggregate) {
+		aggregate_state = executor.distinct_aggregate->GetLocalState();
+	} else if (executor.segment_tree) {
+		aggregate_state = executor.segment_tree->GetLocalState();
+	}
+}
+
+unique_ptr<WindowExecutorState> WindowExecutor::GetLocalState(ClientContext &context) const {
+	return make_uniq<WindowExecutorState>(*this, context);
 }
 
 void WindowExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) {
@@ -797,6 +889,9 @@ void WindowExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const i
 			constant_aggregate->Sink(payload_chunk, filtering, filtered);
 		} else {
 			payload_collection.Append(payload_chunk, true);
+			if (distinct_aggregate) {
+				distinct_aggregate->Sink(payload_chunk, filtering, filtered);
+			}
 		}
 
 		// process payload chunks while they are still piping hot
@@ -834,14 +929,25 @@ void WindowExecutor::Finalize(WindowAggregationMode mode) {
 	// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
 	if (constant_aggregate) {
 		constant_aggregate->Finalize();
+	} else if (distinct_aggregate) {
+		distinct_aggregate->Finalize();
 	} else if (wexpr.aggregate) {
 		segment_tree = make_uniq<WindowSegmentTree>(AggregateObject(wexpr), wexpr.return_type, &payload_collection,
 		                                            filter_mask, mode);
 	}
 }
 
-void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, const ValidityMask &partition_mask,
-                              const ValidityMask &order_mask) {
+void WindowExecutor::Evaluate(WindowExecutorState &lstate, idx_t row_idx, DataChunk &input_chunk, Vector &result,
+                              const ValidityMask &partition_mask, const ValidityMask &order_mask) const {
+	auto &bounds = lstate.bounds;
+	auto &dense_rank = lstate.dense_rank;
+	auto &rank = lstate.rank;
+	auto &rank_equal = lstate.rank_equal;
+	auto &leadlag_offset = lstate.leadlag_offset;
+	auto &leadlag_default = lstate.leadlag_default;
+	auto &boundary_start = lstate.boundary_start;
+	auto &boundary_end = lstate.boundary_end;
+
 	// Evaluate the row-level arguments
 	boundary_start.Execute(input_chunk);
 	boundary_end.Execute(input_chunk);
@@ -852,12 +958,21 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 	// this is the main loop, go through all sorted rows and compute window function result
 	for (idx_t output_offset = 0; output_offset < input_chunk.size(); ++output_offset, ++row_idx) {
 		// special case, OVER (), aggregate over everything
+		const auto is_jump = bounds.is_jump;
 		bounds.Update(row_idx, range, output_offset, boundary_start, boundary_end, partition_mask, order_mask);
 		if (WindowNeedsRank(wexpr)) {
 			if (!bounds.is_same_partition || row_idx == 0) { // special case for first row, need to init
 				dense_rank = 1;
 				rank = 1;
 				rank_equal = 0;
+			} else if (is_jump) {
+				// We started in the middle of the partition, so compute the ranks from the boundaries
+				rank = bounds.peer_start - bounds.partition_start + 1;
+				rank_equal = row_idx - bounds.peer_start;
+				if (wexpr.type == ExpressionType::WINDOW_RANK_DENSE) {
+					dense_rank = CountPeers(order_mask, bounds.peer_start + 1) -
+					             CountPeers(order_mask, bounds.partition_start + 1) + 1;
+				}
 			} else if (!bounds.is_peer) {
 				dense_rank++;
 				rank += rank_equal;
@@ -874,10 +989,15 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 
 		switch (wexpr.type) {
 		case ExpressionType::WINDOW_AGGREGATE: {
+			auto &aggregate_state = *lstate.aggregate_state;
 			if (constant_aggregate) {
-				constant_aggregate->Compute(result, output_offset, bounds.window_start, bounds.window_end);
+				constant_aggregate->Compute(aggregate_state, result, output_offset, bounds.window_start,
+				                            bounds.window_end);
+			} else if (distinct_aggregate) {
+				distinct_aggregate->Compute(aggregate_state, result, output_offset, bounds.window_start,
+				                            bounds.window_end);
 			} else {
-				segment_tree->Compute(result, output_offset, bounds.window_start, bounds.window_end);
+				segment_tree->Compute(aggregate_state, result, output_offset, bounds.window_start, bounds.window_end);
 			}
 			break;
 		}
@@ -1090,64 +1210,27 @@ SinkFinalizeType PhysicalWindow::Finalize(Pipeline &pipeline, Event &event, Clie
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
-class WindowGlobalSourceState : public GlobalSourceState {
-public:
-	explicit WindowGlobalSourceState(WindowGlobalSinkState &gsink) : gsink(*gsink.global_partition), next_bin(0) {
-	}
-
-	PartitionGlobalSinkState &gsink;
-	//! The output read position.
-	atomic<idx_t> next_bin;
-
-public:
-	idx_t MaxThreads() override {
-		// If there is only one partition, we have to process it on one thread.
-		if (!gsink.grouping_data) {
-			return 1;
-		}
-
-		// If there is not a lot of data, process serially.
-		if (gsink.count < STANDARD_ROW_GROUPS_SIZE) {
-			return 1;
-		}
-
-		return gsink.hash_groups.size();
-	}
-};
-
-// Per-thread read state
-class WindowLocalSourceState : public LocalSourceState {
+//! The shared evaluation state of a single hash group.
+//! It is built by one thread, after which its row blocks can be scanned and evaluated by many threads.
+class WindowPartitionSourceState {
 public:
 	using HashGroupPtr = unique_ptr<PartitionGlobalHashGroup>;
 	using WindowExecutorPtr = unique_ptr<WindowExecutor>;
 	using WindowExecutors = vector<WindowExecutorPtr>;
 
-	WindowLocalSourceState(const PhysicalWindow &op_p, ExecutionContext &context, WindowGlobalSourceState &gsource)
-	    : context(context.client), op(op_p), gsink(gsource.gsink) {
-
-		vector<LogicalType> output_types;
-		for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
-			D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
-			auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
-			output_types.emplace_back(wexpr.return_type);
-		}
-		output_chunk.Initialize(Allocator::Get(context.client), output_types);
-
-		const auto &input_types = gsink.payload_types;
-		layout.Initialize(input_types);
-		input_chunk.Initialize(gsink.allocator, input_types);
+	WindowPartitionSourceState(ClientContext &context, const PhysicalWindow &op, PartitionGlobalSinkState &gsink)
+	    : context(context), op(op), gsink(gsink), count(0), external(false) {
+		layout.Initialize(gsink.payload_types);
 	}
 
 	void MaterializeSortedData();
-	void GeneratePartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
-	void Scan(DataChunk &chunk);
+	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
 
-	HashGroupPtr hash_group;
 	ClientContext &context;
 	const PhysicalWindow &op;
-
 	PartitionGlobalSinkState &gsink;
 
+	HashGroupPtr hash_group;
 	//! The generated input chunks
 	unique_ptr<RowDataCollection> rows;
 	unique_ptr<RowDataCollection> heap;
@@ -1161,17 +1244,19 @@ public:
 	//! The current execution functions
 	WindowExecutors window_execs;
 
-	//! The read partition
-	idx_t hash_bin;
-	//! The read cursor
-	unique_ptr<RowDataCollectionScanner> scanner;
-	//! Buffer for the inputs
-	DataChunk input_chunk;
-	//! Buffer for window results
-	DataChunk output_chunk;
+	//! The number of rows in the hash group
+	idx_t count;
+	//! Whether the row data needs unswizzling when it is scanned
+	bool external;
+	//! The partition start of the first row of each block, used to seek the boundaries
+	vector<idx_t> block_starts;
+	//! The next block to evaluate
+	idx_t next_block = 0;
+	//! The number of blocks whose evaluation has not finished
+	idx_t blocks_remaining = 0;
 };
 
-void WindowLocalSourceState::MaterializeSortedData() {
+void WindowPartitionSourceState::MaterializeSortedData() {
 	auto &global_sort_state = *hash_group->global_sort;
 	if (global_sort_state.sorted_blocks.empty()) {
 		return;
@@ -1210,17 +1295,13 @@ void WindowLocalSourceState::MaterializeSortedData() {
 	                              [&](idx_t c, const unique_ptr<RowDataBlock> &b) { return c + b->count; });
 }
 
-void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, const idx_t hash_bin_p) {
-	//	Get rid of any stale data
-	hash_bin = hash_bin_p;
-
+void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin) {
 	// There are three types of partitions:
 	// 1. No partition (no sorting)
 	// 2. One partition (sorting, but no hashing)
 	// 3. Multiple partitions (sorting and hashing)
 
 	//	How big is the partition?
-	idx_t count = 0;
 	if (hash_bin < gsink.hash_groups.size() && gsink.hash_groups[hash_bin]) {
 		count = gsink.hash_groups[hash_bin]->count;
 	} else if (gsink.rows && !hash_bin) {
@@ -1240,7 +1321,7 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	order_mask.Initialize(order_bits.data());
 
 	// Scan the sorted data into new Collections
-	auto external = gsink.external;
+	external = gsink.external;
 	if (gsink.rows && !hash_bin) {
 		// Simple mask
 		partition_mask.SetValidUnsafe(0);
@@ -1250,12 +1331,14 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 		heap = gsink.strings->CloneEmpty(gsink.strings->keep_pinned);
 		RowDataCollectionScanner::AlignHeapBlocks(*rows, *heap, *gsink.rows, *gsink.strings, layout);
 		external = true;
-	} else if (hash_bin < gsink.hash_groups.size() && gsink.hash_groups[hash_bin]) {
+	} else {
 		// Overwrite the collections with the sorted data
 		hash_group = std::move(gsink.hash_groups[hash_bin]);
 		hash_group->ComputeMasks(partition_mask, order_mask);
 		MaterializeSortedData();
-	} else {
+	}
+
+	if (!rows || rows->blocks.empty()) {
 		return;
 	}
 
@@ -1264,24 +1347,25 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
-		auto wexec = make_uniq<WindowExecutor>(wexpr, context, partition_mask, count);
+		auto wexec = make_uniq<WindowExecutor>(wexpr, context, partition_mask, order_mask, count);
 		window_execs.emplace_back(std::move(wexec));
 	}
 
 	//	First pass over the input without flushing
-	//	TODO: Factor out the constructor data as global state
-	scanner = make_uniq<RowDataCollectionScanner>(*rows, *heap, layout, external, false);
+	DataChunk input_chunk;
+	input_chunk.Initialize(gsink.allocator, gsink.payload_types);
+	RowDataCollectionScanner scanner(*rows, *heap, layout, external, false);
 	idx_t input_idx = 0;
 	while (true) {
 		input_chunk.Reset();
-		scanner->Scan(input_chunk);
+		scanner.Scan(input_chunk);
 		if (input_chunk.size() == 0) {
 			break;
 		}
 
 		//	TODO: Parallelization opportunity
 		for (auto &wexec : window_execs) {
-			wexec->Sink(input_chunk, input_idx, scanner->Count());
+			wexec->Sink(input_chunk, input_idx, scanner.Count());
 		}
 		input_idx += input_chunk.size();
 	}
@@ -1292,10 +1376,229 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	}
 
 	// External scanning assumes all blocks are swizzled.
-	scanner->ReSwizzle();
+	scanner.ReSwizzle();
+
+	//	Find the partition containing the first row of each block, so evaluation can start at any block
+	idx_t block_begin = 0;
+	idx_t partition_begin = 0;
+	for (auto &block : rows->blocks) {
+		idx_t n = 1;
+		partition_begin = FindPrevStart(partition_mask, partition_begin, block_begin + 1, n);
+		block_starts.emplace_back(partition_begin);
+		block_begin += block->count;
+	}
+	blocks_remaining = rows->blocks.size();
+}
+
+class WindowLocalSourceState;
+
+class WindowGlobalSourceState : public GlobalSourceState {
+public:
+	using WindowPartitionSourceStatePtr = unique_ptr<WindowPartitionSourceState>;
+
+	WindowGlobalSourceState(ClientContext &context, const PhysicalWindow &op, WindowGlobalSinkState &gstate)
+	    : context(context), op(op), gstate(gstate), gsink(*gstate.global_partition), next_build(0),
+	      builds_in_progress(0) {
+		auto &hash_groups = gsink.hash_groups;
+		const auto bin_count = hash_groups.empty() ? 1 : hash_groups.size();
+		built.resize(bin_count);
+	}
+
+	ClientContext &context;
+	const PhysicalWindow &op;
+	WindowGlobalSinkState &gstate;
+	PartitionGlobalSinkState &gsink;
+
+	//! Assign the next block to evaluate, building hash groups as needed. Returns FINISHED when there are none left,
+	//! or BLOCKED if the remaining blocks belong to hash groups that other threads are still building.
+	SourceResultType AssignTask(WindowLocalSourceState &lsource, InterruptState &interrupt_state);
+	//! Finish evaluating a block, releasing its hash group after the last one
+	void FinishTask(WindowPartitionSourceState &partition);
+
+public:
+	idx_t MaxThreads() override {
+		// If there is not a lot of data, process serially.
+		if (gsink.count < STANDARD_ROW_GROUPS_SIZE) {
+			return 1;
+		}
+
+		// Each row block can be evaluated separately
+		if (!gsink.grouping_data) {
+			return gsink.rows ? MaxValue<idx_t>(gsink.rows->blocks.size(), 1) : 1;
+		}
+
+		idx_t block_count = 0;
+		for (auto &hash_group : gsink.hash_groups) {
+			if (!hash_group) {
+				continue;
+			}
+			auto &global_sort = *hash_group->global_sort;
+			if (global_sort.sorted_blocks.empty()) {
+				continue;
+			}
+			block_count += global_sort.sorted_blocks[0]->payload_data->data_blocks.size();
+		}
+		return MaxValue<idx_t>(block_count, 1);
+	}
+
+private:
+	//! Protects the task state
+	mutex lock;
+	//! The next hash group to build
+	idx_t next_build;
+	//! The number of hash groups being built
+	idx_t builds_in_progress;
+	//! The built hash groups, indexed by hash bin
+	vector<WindowPartitionSourceStatePtr> built;
+	//! The built hash groups that still have blocks to assign, in build order
+	deque<idx_t> ready;
+	//! The tasks waiting for a hash group to be built
+	vector<InterruptState> blocked_tasks;
+};
 
-	//	Second pass can flush
-	scanner->Reset(true);
+// Per-thread read state
+class WindowLocalSourceState : public LocalSourceState {
+public:
+	using WindowExecutorStatePtr = unique_ptr<WindowExecutorState>;
+	using WindowExecutorStates = vector<WindowExecutorStatePtr>;
+
+	WindowLocalSourceState(const PhysicalWindow &op_p, ExecutionContext &context, WindowGlobalSourceState &gsource)
+	    : context(context.client), op(op_p), gsource(gsource), partition(nullptr), block_idx(0) {
+
+		vector<LogicalType> output_types;
+		for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
+			D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
+			auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
+			output_types.emplace_back(wexpr.return_type);
+		}
+		output_chunk.Initialize(Allocator::Get(context.client), output_types);
+
+		const auto &input_types = gsource.gsink.payload_types;
+		input_chunk.Initialize(gsource.gsink.allocator, input_types);
+	}
+
+	//! Start evaluating a block of a built hash group
+	void BeginTask(WindowPartitionSourceState &partition, const idx_t block_idx);
+	//! Release the block, returning false if there was none
+	bool EndTask();
+	void Scan(DataChunk &chunk);
+
+	ClientContext &context;
+	const PhysicalWindow &op;
+	WindowGlobalSourceState &gsource;
+
+	//! The hash group being read
+	WindowPartitionSourceState *partition;
+	//! The block being read
+	idx_t block_idx;
+	//! The thread-local evaluation state of each function
+	WindowExecutorStates window_states;
+	//! The read cursor
+	unique_ptr<RowDataCollectionScanner> scanner;
+	//! Buffer for the inputs
+	DataChunk input_chunk;
+	//! Buffer for window results
+	DataChunk output_chunk;
+};
+
+SourceResultType WindowGlobalSourceState::AssignTask(WindowLocalSourceState &lsource,
+                                                    InterruptState &interrupt_state) {
+	const auto bin_count = built.size();
+	unique_lock<mutex> guard(lock);
+	while (true) {
+		//	Prefer the blocks of hash groups that have already been built
+		//	(they may already have been released if their last block has finished)
+		while (!ready.empty()) {
+			auto partition = built[ready.front()].get();
+			if (partition && partition->next_block < partition->block_starts.size()) {
+				const auto block_idx = partition->next_block++;
+				guard.unlock();
+				lsource.BeginTask(*partition, block_idx);
+				return SourceResultType::HAVE_MORE_OUTPUT;
+			}
+			ready.pop_front();
+		}
+
+		//	Otherwise build the next hash group
+		if (next_build >= bin_count) {
+			break;
+		}
+		const auto hash_bin = next_build++;
+		++builds_in_progress;
+		guard.unlock();
+
+		auto partition = make_uniq<WindowPartitionSourceState>(context, op, gsink);
+		partition->BuildPartition(gstate, hash_bin);
+
+		guard.lock();
+		--builds_in_progress;
+		if (partition->blocks_remaining) {
+			built[hash_bin] = std::move(partition);
+			ready.emplace_back(hash_bin);
+		}
+
+		//	Wake up the tasks that were waiting for a build to finish
+		auto unblocked = std::move(blocked_tasks);
+		blocked_tasks.clear();
+		guard.unlock();
+		for (auto &blocked_task : unblocked) {
+			blocked_task.Callback();
+		}
+		guard.lock();
+	}
+
+	//	Nothing is left to build, so we are done unless a build can still produce blocks
+	if (!builds_in_progress) {
+		return SourceResultType::FINISHED;
+	}
+	blocked_tasks.push_back(interrupt_state);
+	return SourceResultType::BLOCKED;
+}
+
+void WindowGlobalSourceState::FinishTask(WindowPartitionSourceState &partition) {
+	lock_guard<mutex> guard(lock);
+	if (--partition.blocks_remaining) {
+		return;
+	}
+
+	//	Release the hash group once all its blocks have been evaluated
+	for (auto &hash_group : built) {
+		if (hash_group.get() == &partition) {
+			hash_group.reset();
+			break;
+		}
+	}
+}
+
+void WindowLocalSourceState::BeginTask(WindowPartitionSourceState &partition_p, const idx_t block_idx_p) {
+	partition = &partition_p;
+	block_idx = block_idx_p;
+
+	auto &window_execs = partition->window_execs;
+	const auto partition_begin = partition->block_starts[block_idx];
+	window_states.clear();
+	for (auto &wexec : window_execs) {
+		auto wstate = wexec->GetLocalState(context);
+		wstate->bounds.Seek(partition_begin);
+		window_states.emplace_back(std::move(wstate));
+	}
+
+	scanner = make_uniq<RowDataCollectionScanner>(*partition->rows, *partition->heap, partition->layout,
+	                                              partition->external, block_idx, true);
+}
+
+bool WindowLocalSourceState::EndTask() {
+	if (!partition) {
+		return false;
+	}
+
+	//	The local states reference the hash group, so they have to go first
+	scanner.reset();
+	window_states.clear();
+	gsource.FinishTask(*partition);
+	partition = nullptr;
+
+	return true;
 }
 
 void WindowLocalSourceState::Scan(DataChunk &result) {
@@ -1308,10 +1611,12 @@ void WindowLocalSourceState::Scan(DataChunk &result) {
 	input_chunk.Reset();
 	scanner->Scan(input_chunk);
 
+	auto &window_execs = partition->window_execs;
 	output_chunk.Reset();
 	for (idx_t expr_idx = 0; expr_idx < window_execs.size(); ++expr_idx) {
 		auto &executor = *window_execs[expr_idx];
-		executor.Evaluate(position, input_chunk, output_chunk.data[expr_idx], partition_mask, order_mask);
+		executor.Evaluate(*window_states[expr_idx], position, input_chunk, output_chunk.data[expr_idx],
+		                  partition->partition_mask, partition->order_mask);
 	}
 	output_chunk.SetCardinality(input_chunk);
 	output_chunk.Verify();
@@ -1335,42 +1640,51 @@ unique_ptr<LocalSourceState> PhysicalWindow::GetLocalSourceState(ExecutionContex
 
 unique_ptr<GlobalSourceState> PhysicalWindow::GetGlobalSourceState(ClientContext &context) const {
 	auto &gsink = sink_state->Cast<WindowGlobalSinkState>();
-	return make_uniq<WindowGlobalSourceState>(gsink);
+	return make_uniq<WindowGlobalSourceState>(context, *this, gsink);
 }
 
 SourceResultType PhysicalWindow::GetData(ExecutionContext &context, DataChunk &chunk,
                                          OperatorSourceInput &input) const {
 	auto &lsource = input.local_state.Cast<WindowLocalSourceState>();
 	auto &gsource = input.global_state.Cast<WindowGlobalSourceState>();
-	auto &gsink = sink_state->Cast<WindowGlobalSinkState>();
-
-	auto &hash_groups = gsink.global_partition->hash_groups;
-	const auto bin_count = hash_groups.empty() ? 1 : hash_groups.size();
 
 	while (chunk.size() == 0) {
-		//	Move to the next bin if we are done.
+		//	Move to the next block if we are done.
 		while (!lsource.scanner || !lsource.scanner->Remaining()) {
-			lsource.scanner.reset();
-			lsource.rows.reset();
-			lsource.heap.reset();
-			lsource.hash_group.reset();
-			auto hash_bin = gsource.next_bin++;
-			if (hash_bin >= bin_count) {
-				return chunk.size() > 0 ? SourceResultType::HAVE_MORE_OUTPUT : SourceResultType::FINISHED;
+			lsource.EndTask();
+			auto result = gsource.AssignTask(lsource, input.interrupt_state);
+			if (result != SourceResultType::HAVE_MORE_OUTPUT) {
+				return result;
 			}
-
-			for (; hash_bin < hash_groups.size(); hash_bin = gsource.next_bin++) {
-				if (hash_groups[hash_bin]) {
-					break;
-				}
-			}
-			lsource.GeneratePartition(gsink, hash_bin);
 		}
 
 		lsource.Scan(chunk);
 	}
 
-	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+	return SourceResultType::HAVE_MORE_OUTPUT;
+}
+
+bool PhysicalWindow::SupportsBatchIndex() const {
+	//	Without partitions there is a single hash group, whose blocks are assigned in order
+	auto &wexpr = select_list[0]->Cast<BoundWindowExpression>();
+	return wexpr.partitions.empty();
+}
+
+OrderPreservationType PhysicalWindow::SourceOrder() const {
+	auto &wexpr = select_list[0]->Cast<BoundWindowExpression>();
+	if (!wexpr.partitions.empty() || wexpr.orders.empty()) {
+		//	The order of the hash groups is not defined, and neither is the order in which
+		//	the threads combined their rows when there is no ORDER BY
+		return OrderPreservationType::NO_ORDER;
+	}
+	return OrderPreservationType::FIXED_ORDER;
+}
+
+idx_t PhysicalWindow::GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
+                                    LocalSourceState &lstate_p) const {
+	D_ASSERT(SupportsBatchIndex());
+	auto &lstate = lstate_p.Cast<WindowLocalSourceState>();
+	return lstate.block_idx;
 }
 
 string PhysicalWindow::ParamsToString() const {
@@ -11,7 +11,11 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
@@ -64,6 +68,14 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+		// Min/max and Bloom filter of the build-side keys that are pushed into the probe-side scan
+		for (auto &pushdown_column : op.filter_pushdown) {
+			filter_stats.push_back(NumericStats::CreateEmpty(op.condition_types[pushdown_column.join_condition]));
+			bloom_filters.push_back(make_uniq<BloomFilter>());
+			// the plan can be executed more than once (e.g. prepared statements, recursive CTEs):
+			// the filters pushed by a previous execution no longer apply
+			pushdown_column.dynamic_filters->ClearFilters(op);
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
@@ -84,6 +96,10 @@ public:
 	//! Hash tables built by each thread
 	mutex lock;
 	vector<unique_ptr<JoinHashTable>> local_hash_tables;
+	//! Min/max of the build-side keys that are pushed into probe-side table scans
+	vector<BaseStatistics> filter_stats;
+	//! Bloom filters of the build-side keys that are pushed into probe-side table scans
+	vector<unique_ptr<BloomFilter>> bloom_filters;
 
 	//! Excess probe data gathered during Sink
 	vector<LogicalType> probe_types;
@@ -108,6 +124,11 @@ public:
 		hash_table = op.InitializeHashTable(context);
 
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		for (auto &pushdown_column : op.filter_pushdown) {
+			filter_stats.push_back(NumericStats::CreateEmpty(op.condition_types[pushdown_column.join_condition]));
+			bloom_filters.push_back(make_uniq<BloomFilter>());
+		}
 	}
 
 public:
@@ -119,6 +140,10 @@ public:
 
 	//! Thread-local HT
 	unique_ptr<JoinHashTable> hash_table;
+	//! Thread-local min/max of the build-side keys that are pushed into probe-side table scans
+	vector<BaseStatistics> filter_stats;
+	//! Thread-local Bloom filters of the build-side keys that are pushed into probe-side table scans
+	vector<unique_ptr<BloomFilter>> bloom_filters;
 };
 
 unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &context) const {
@@ -181,6 +206,58 @@ unique_ptr<LocalSinkState> PhysicalHashJoin::GetLocalSinkState(ExecutionContext
 	return make_uniq<HashJoinLocalSinkState>(*this, context.client);
 }
 
+template <class T>
+static void TemplatedUpdateFilterStatistics(BaseStatistics &stats, Vector &keys, idx_t count) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+
+	auto min = NumericStats::GetMin<T>(stats);
+	auto max = NumericStats::GetMax<T>(stats);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (vdata.validity.RowIsValid(idx)) {
+			NumericStats::UpdateValue<T>(data[idx], min, max);
+		}
+	}
+	NumericStats::Update<T>(stats, min);
+	NumericStats::Update<T>(stats, max);
+}
+
+static void UpdateFilterStatistics(BaseStatistics &stats, Vector &keys, idx_t count) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedUpdateFilterStatistics<int8_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateFilterStatistics<int16_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateFilterStatistics<int32_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateFilterStatistics<int64_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateFilterStatistics<hugeint_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateFilterStatistics<uint8_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateFilterStatistics<uint16_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateFilterStatistics<uint32_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateFilterStatistics<uint64_t>(stats, keys, count);
+		break;
+	default:
+		throw InternalException("Unsupported type for join filter pushdown");
+	}
+}
+
 SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &lstate = input.local_state.Cast<HashJoinLocalSinkState>();
 
@@ -188,6 +265,17 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	lstate.join_keys.Reset();
 	lstate.build_executor.Execute(chunk, lstate.join_keys);
 
+	// keep track of the min/max and the Bloom filter of the keys that are pushed into the probe side
+	for (idx_t i = 0; i < filter_pushdown.size(); i++) {
+		auto &keys = lstate.join_keys.data[filter_pushdown[i].join_condition];
+		UpdateFilterStatistics(lstate.filter_stats[i], keys, lstate.join_keys.size());
+		auto &bloom_filter = *lstate.bloom_filters[i];
+		if (bloom_filter.key_count <= BloomFilter::MAX_KEYS) {
+			// past the maximum the filter is not pushed, so we stop inserting keys
+			bloom_filter.Insert(keys, lstate.join_keys.size());
+		}
+	}
+
 	// build the HT
 	auto &ht = *lstate.hash_table;
 	if (!right_projection_map.empty()) {
@@ -217,6 +305,10 @@ void PhysicalHashJoin::Combine(ExecutionContext &context, GlobalSinkState &gstat
 		lstate.hash_table->GetSinkCollection().FlushAppendState(lstate.append_state);
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
+		for (idx_t i = 0; i < lstate.filter_stats.size(); i++) {
+			gstate.filter_stats[i].Merge(lstate.filter_stats[i]);
+			gstate.bloom_filters[i]->Merge(*lstate.bloom_filters[i]);
+		}
 	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.build_executor, "build_executor", 1);
@@ -361,11 +453,43 @@ public:
 	}
 };
 
+void PhysicalHashJoin::PushJoinFilters(HashJoinGlobalSinkState &sink) const {
+	for (idx_t i = 0; i < filter_pushdown.size(); i++) {
+		auto &stats = sink.filter_stats[i];
+		auto min = NumericStats::Min(stats);
+		auto max = NumericStats::Max(stats);
+		if (min > max) {
+			// no (non-NULL) keys on the build side
+			continue;
+		}
+		auto &pushdown_column = filter_pushdown[i];
+		auto &dynamic_filters = *pushdown_column.dynamic_filters;
+		if (min == max) {
+			dynamic_filters.PushFilter(*this, pushdown_column.scan_column_index,
+			                           make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min)));
+		} else {
+			dynamic_filters.PushFilter(*this, pushdown_column.scan_column_index,
+			                           make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
+			                                                     std::move(min)));
+			dynamic_filters.PushFilter(
+			    *this, pushdown_column.scan_column_index,
+			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max)));
+			// the range does not exclude the keys in between the build-side keys: the Bloom filter does
+			if (sink.bloom_filters[i]->key_count <= BloomFilter::MAX_KEYS) {
+				dynamic_filters.PushFilter(*this, pushdown_column.scan_column_index, std::move(sink.bloom_filters[i]));
+			}
+		}
+	}
+}
+
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                             GlobalSinkState &gstate) const {
 	auto &sink = gstate.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	// the build side is complete: filter the probe-side scans on the range of the build-side keys
+	PushJoinFilters(sink);
+
 	sink.external = ht.RequiresExternalJoin(context.config, sink.local_hash_tables);
 	if (sink.external) {
 		sink.perfect_join_executor.reset();
@@ -13,6 +13,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/column_definition.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include "utf8proc_wrapper.hpp"
 #include "utf8proc.hpp"
 #include "duckdb/parser/keyword_helper.hpp"
@@ -66,6 +67,19 @@ void BaseCSVReader::InitializeProjection() {
 		reader_data.column_ids.push_back(i);
 		reader_data.column_mapping.push_back(i);
 	}
+	projected_columns.clear();
+}
+
+void BaseCSVReader::InitializeProjectedColumns() {
+	projected_columns.clear();
+	if (reader_data.column_ids.size() == return_types.size()) {
+		// all columns are read
+		return;
+	}
+	projected_columns.resize(return_types.size(), false);
+	for (auto &col_idx : reader_data.column_ids) {
+		projected_columns[col_idx] = true;
+	}
 }
 
 void BaseCSVReader::SetDateFormat(const string &format_specifier, const LogicalTypeId &sql_type) {
@@ -271,6 +285,12 @@ void BaseCSVReader::AddValue(string_t str_val, idx_t &column, vector<idx_t> &esc
 			    options.ToString());
 		}
 	}
+	if (mode == ParserMode::PARSING && !projected_columns.empty() && !projected_columns[column]) {
+		// the column is not projected: skip the value without copying or checking it
+		escape_positions.clear();
+		column++;
+		return;
+	}
 
 	// insert the line number into the chunk
 	idx_t row_entry = parse_chunk.size();
@@ -448,6 +468,146 @@ bool TryCastFloatingVectorCommaSeparated(BufferedCSVReaderOptions &options, Vect
 	}
 }
 
+bool BaseCSVReader::ConvertColumn(idx_t c, DataChunk &insert_chunk, idx_t buffer_idx, bool try_add_line,
+                                  bool &conversion_error_ignored, const SelectionVector &sel, idx_t parsed_count) {
+	auto col_idx = reader_data.column_ids[c];
+	auto result_idx = reader_data.column_mapping[c];
+	auto &parse_vector = parse_chunk.data[col_idx];
+	auto &result_vector = insert_chunk.data[result_idx];
+	auto &type = result_vector.GetType();
+	if (type.id() == LogicalTypeId::VARCHAR) {
+		// target type is varchar: no need to convert
+		// just test that all strings are valid utf-8 strings
+		VerifyUTF8(col_idx);
+		// reinterpret rather than reference so we can deal with user-defined types
+		result_vector.Reinterpret(parse_vector);
+		return true;
+	}
+	string error_message;
+	bool success;
+	idx_t line_error = 0;
+	bool target_type_not_varchar = false;
+	if (options.has_format[LogicalTypeId::DATE] && type.id() == LogicalTypeId::DATE) {
+		// use the date format to cast the chunk
+		success =
+		    TryCastDateVector(options, parse_vector, result_vector, parse_chunk.size(), error_message, line_error);
+	} else if (options.has_format[LogicalTypeId::TIMESTAMP] && type.id() == LogicalTypeId::TIMESTAMP) {
+		// use the date format to cast the chunk
+		success = TryCastTimestampVector(options, parse_vector, result_vector, parse_chunk.size(), error_message);
+	} else if (options.decimal_separator != "." &&
+	           (type.id() == LogicalTypeId::FLOAT || type.id() == LogicalTypeId::DOUBLE)) {
+		success = TryCastFloatingVectorCommaSeparated(options, parse_vector, result_vector, parse_chunk.size(),
+		                                              error_message, type, line_error);
+	} else if (options.decimal_separator != "." && type.id() == LogicalTypeId::DECIMAL) {
+		success = TryCastDecimalVectorCommaSeparated(options, parse_vector, result_vector, parse_chunk.size(),
+		                                             error_message, type);
+	} else {
+		// target type is not varchar: perform a cast
+		target_type_not_varchar = true;
+		success = VectorOperations::TryCast(context, parse_vector, result_vector, parse_chunk.size(), &error_message);
+	}
+	if (success) {
+		return true;
+	}
+	if (try_add_line) {
+		return false;
+	}
+	if (options.ignore_errors) {
+		conversion_error_ignored = true;
+		return true;
+	}
+	string col_name = to_string(col_idx);
+	if (col_idx < names.size()) {
+		col_name = "\"" + names[col_idx] + "\"";
+	}
+
+	// figure out the exact line number
+	if (target_type_not_varchar) {
+		UnifiedVectorFormat inserted_column_data;
+		result_vector.ToUnifiedFormat(parse_chunk.size(), inserted_column_data);
+		for (; line_error < parse_chunk.size(); line_error++) {
+			if (!inserted_column_data.validity.RowIsValid(line_error) &&
+			    !FlatVector::IsNull(parse_vector, line_error)) {
+				break;
+			}
+		}
+	}
+
+	idx_t error_line;
+	// The line_error must be summed with linenr (All lines emmited from this batch)
+	// But subtracted from the lines that were parsed (before filtering) in this chunk
+	line_error = sel.get_index(line_error);
+	D_ASSERT(line_error + linenr >= parsed_count);
+	line_error += linenr;
+	line_error -= parsed_count;
+
+	error_line = GetLineError(line_error, buffer_idx);
+
+	if (options.auto_detect) {
+		throw InvalidInputException("%s in column %s, at line %llu.\n\nParser "
+		                            "options:\n%s.\n\nConsider either increasing the sample size "
+		                            "(SAMPLE_SIZE=X [X rows] or SAMPLE_SIZE=-1 [all rows]), "
+		                            "or skipping column conversion (ALL_VARCHAR=1)",
+		                            error_message, col_name, error_line, options.ToString());
+	} else {
+		throw InvalidInputException("%s at line %llu in column %s. Parser options:\n%s ", error_message, error_line,
+		                            col_name, options.ToString());
+	}
+}
+
+idx_t BaseCSVReader::ApplyFilters(DataChunk &insert_chunk, idx_t buffer_idx, SelectionVector &sel,
+                                  vector<bool> &converted, bool &conversion_error_ignored) {
+	auto parsed_count = parse_chunk.size();
+	sel.Initialize(parsed_count);
+	for (idx_t i = 0; i < parsed_count; i++) {
+		sel.set_index(i, i);
+	}
+	idx_t approved_count = parsed_count;
+	for (auto &entry : reader_data.filters->filters) {
+		if (approved_count == 0) {
+			// no rows are left, we can stop checking filters
+			break;
+		}
+		auto &filter_entry = reader_data.filter_map[entry.first];
+		if (filter_entry.is_constant) {
+			// a constant (e.g. a hive partition) either passes the filter for all rows or for none of them
+			Vector constant_vector(reader_data.constant_map[filter_entry.index].value);
+			constant_vector.Flatten(1);
+			SelectionVector constant_sel(1);
+			constant_sel.set_index(0, 0);
+			idx_t constant_count = 1;
+			ColumnSegment::FilterSelection(constant_sel, constant_vector, *entry.second, constant_count,
+			                               FlatVector::Validity(constant_vector));
+			if (constant_count == 0) {
+				approved_count = 0;
+			}
+			continue;
+		}
+		auto c = filter_entry.index;
+		if (!converted[c]) {
+			ConvertColumn(c, insert_chunk, buffer_idx, false, conversion_error_ignored,
+			              *FlatVector::IncrementalSelectionVector(), parsed_count);
+			converted[c] = true;
+		}
+		auto &result_vector = insert_chunk.data[reader_data.column_mapping[c]];
+		result_vector.Flatten(parsed_count);
+		ColumnSegment::FilterSelection(sel, result_vector, *entry.second, approved_count,
+		                               FlatVector::Validity(result_vector));
+	}
+	return approved_count;
+}
+
+//! Moves the selected rows of a parsed column to the front of the vector, the selection has to be increasing
+static void CompactParsedColumn(Vector &parse_vector, const SelectionVector &sel, idx_t count) {
+	auto parse_data = FlatVector::GetData<string_t>(parse_vector);
+	auto &validity = FlatVector::Validity(parse_vector);
+	for (idx_t i = 0; i < count; i++) {
+		auto row_idx = sel.get_index(i);
+		parse_data[i] = parse_data[row_idx];
+		validity.Set(i, validity.RowIsValid(row_idx));
+	}
+}
+
 bool BaseCSVReader::Flush(DataChunk &insert_chunk, idx_t buffer_idx, bool try_add_line) {
 	if (parse_chunk.size() == 0) {
 		return true;
@@ -462,90 +622,48 @@ bool BaseCSVReader::Flush(DataChunk &insert_chunk, idx_t buffer_idx, bool try_ad
 		                        "MultiFileReader::InitializeReader or InitializeProjection");
 	}
 	D_ASSERT(reader_data.column_ids.size() == reader_data.column_mapping.size());
-	for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
-		auto col_idx = reader_data.column_ids[c];
-		auto result_idx = reader_data.column_mapping[c];
-		auto &parse_vector = parse_chunk.data[col_idx];
-		auto &result_vector = insert_chunk.data[result_idx];
-		auto &type = result_vector.GetType();
-		if (type.id() == LogicalTypeId::VARCHAR) {
-			// target type is varchar: no need to convert
-			// just test that all strings are valid utf-8 strings
-			VerifyUTF8(col_idx);
-			// reinterpret rather than reference so we can deal with user-defined types
-			result_vector.Reinterpret(parse_vector);
-		} else {
-			string error_message;
-			bool success;
-			idx_t line_error = 0;
-			bool target_type_not_varchar = false;
-			if (options.has_format[LogicalTypeId::DATE] && type.id() == LogicalTypeId::DATE) {
-				// use the date format to cast the chunk
-				success = TryCastDateVector(options, parse_vector, result_vector, parse_chunk.size(), error_message,
-				                            line_error);
-			} else if (options.has_format[LogicalTypeId::TIMESTAMP] && type.id() == LogicalTypeId::TIMESTAMP) {
-				// use the date format to cast the chunk
-				success =
-				    TryCastTimestampVector(options, parse_vector, result_vector, parse_chunk.size(), error_message);
-			} else if (options.decimal_separator != "." &&
-			           (type.id() == LogicalTypeId::FLOAT || type.id() == LogicalTypeId::DOUBLE)) {
-				success = TryCastFloatingVectorCommaSeparated(options, parse_vector, result_vector, parse_chunk.size(),
-				                                              error_message, type, line_error);
-			} else if (options.decimal_separator != "." && type.id() == LogicalTypeId::DECIMAL) {
-				success = TryCastDecimalVectorCommaSeparated(options, parse_vector, result_vector, parse_chunk.size(),
-				                                             error_message, type);
-			} else {
-				// target type is not varchar: perform a cast
-				target_type_not_varchar = true;
-				success =
-				    VectorOperations::TryCast(context, parse_vector, result_vector, parse_chunk.size(), &error_message);
-			}
-			if (success) {
-				continue;
-			}
-			if (try_add_line) {
-				return false;
-			}
-			if (options.ignore_errors) {
-				conversion_error_ignored = true;
-				continue;
-			}
-			string col_name = to_string(col_idx);
-			if (col_idx < names.size()) {
-				col_name = "\"" + names[col_idx] + "\"";
-			}
-
-			// figure out the exact line number
-			if (target_type_not_varchar) {
-				UnifiedVectorFormat inserted_column_data;
-				result_vector.ToUnifiedFormat(parse_chunk.size(), inserted_column_data);
-				for (; line_error < parse_chunk.size(); line_error++) {
-					if (!inserted_column_data.validity.RowIsValid(line_error) &&
-					    !FlatVector::IsNull(parse_vector, line_error)) {
-						break;
+	auto parsed_count = parse_chunk.size();
+	auto sel = FlatVector::IncrementalSelectionVector();
+	SelectionVector filter_sel;
+	vector<bool> converted(reader_data.column_ids.size(), false);
+	if (reader_data.filters && !try_add_line) {
+		// the columns used in the filters are converted first
+		// the other columns are only converted for the rows that pass the filters
+		auto approved_count = ApplyFilters(insert_chunk, buffer_idx, filter_sel, converted, conversion_error_ignored);
+		if (approved_count == 0) {
+			// no rows pass the filters
+			insert_chunk.SetCardinality(0);
+			filtered_row_count += parsed_count;
+			parse_chunk.Reset();
+			return true;
+		}
+		if (approved_count < parsed_count) {
+			for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
+				auto &result_vector = insert_chunk.data[reader_data.column_mapping[c]];
+				if (converted[c]) {
+					if (result_vector.GetType().id() == LogicalTypeId::VARCHAR) {
+						// varchar columns reference the parsed column, they are converted again after compacting it
+						converted[c] = false;
+					} else {
+						result_vector.Slice(filter_sel, approved_count);
+						result_vector.Flatten(approved_count);
 					}
 				}
+				CompactParsedColumn(parse_chunk.data[reader_data.column_ids[c]], filter_sel, approved_count);
 			}
-
-			idx_t error_line;
-			// The line_error must be summed with linenr (All lines emmited from this batch)
-			// But subtracted from the parse_chunk
-			D_ASSERT(line_error + linenr >= parse_chunk.size());
-			line_error += linenr;
-			line_error -= parse_chunk.size();
-
-			error_line = GetLineError(line_error, buffer_idx);
-
-			if (options.auto_detect) {
-				throw InvalidInputException("%s in column %s, at line %llu.\n\nParser "
-				                            "options:\n%s.\n\nConsider either increasing the sample size "
-				                            "(SAMPLE_SIZE=X [X rows] or SAMPLE_SIZE=-1 [all rows]), "
-				                            "or skipping column conversion (ALL_VARCHAR=1)",
-				                            error_message, col_name, error_line, options.ToString());
-			} else {
-				throw InvalidInputException("%s at line %llu in column %s. Parser options:\n%s ", error_message,
-				                            error_line, col_name, options.ToString());
-			}
+			parse_chunk.SetCardinality(approved_count);
+			insert_chunk.SetCardinality(approved_count);
+			filtered_row_count += parsed_count - approved_count;
+			sel = &filter_sel;
+		}
+	}
+	for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
+		if (converted[c]) {
+			continue;
+		}
+		if (!ConvertColumn(c, insert_chunk, buffer_idx, try_add_line, conversion_error_ignored, *sel,
+		                   parsed_count)) {
+			return false;
 		}
 	}
 	if (conversion_error_ignored) {
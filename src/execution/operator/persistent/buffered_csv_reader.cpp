@@ -2,11 +2,15 @@
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/field_writer.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/to_string.hpp"
 #include "duckdb/common/types/cast_helpers.hpp"
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/operator/persistent/csv_character_scanner.hpp"
+#include "duckdb/execution/operator/persistent/csv_sniff_cache.hpp"
 #include "duckdb/function/scalar/strftime_format.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/column_definition.hpp"
@@ -235,7 +239,7 @@ static string NormalizeColumnName(const string &col_name) {
 void BufferedCSVReader::Initialize(const vector<LogicalType> &requested_types) {
 	PrepareComplexParser();
 	if (options.auto_detect) {
-		return_types = SniffCSV(requested_types);
+		return_types = SniffCSVCached(requested_types);
 		if (return_types.empty()) {
 			throw InvalidInputException("Failed to detect column types from CSV: is the file a valid CSV file?");
 		}
@@ -918,6 +922,57 @@ vector<LogicalType> BufferedCSVReader::SniffCSV(const vector<LogicalType> &reque
 	                           best_format_candidates);
 }
 
+//! Serializes everything that influences the result of sniffing a file, including the options that are not part of
+//! BufferedCSVReaderOptions::Serialize
+static string SniffOptionsFingerprint(const BufferedCSVReaderOptions &options,
+                                      const vector<LogicalType> &requested_types) {
+	BufferedSerializer serializer;
+	FieldWriter writer(serializer);
+	options.Serialize(writer);
+	vector<string> types_per_column;
+	for (auto &entry : options.sql_types_per_column) {
+		types_per_column.push_back(entry.first + "=" + to_string(entry.second));
+	}
+	std::sort(types_per_column.begin(), types_per_column.end());
+	writer.WriteList<string>(types_per_column);
+	writer.WriteRegularSerializableList(options.sql_type_list);
+	writer.WriteList<string>(options.name_list);
+	writer.WriteRegularSerializableList(options.auto_type_candidates);
+	for (auto &format : options.has_format) {
+		writer.WriteField<bool>(format.second);
+	}
+	writer.WriteRegularSerializableList(requested_types);
+	writer.Finalize();
+	auto data = serializer.GetData();
+	return string(const_char_ptr_cast(data.data.get()), data.size);
+}
+
+vector<LogicalType> BufferedCSVReader::SniffCSVCached(const vector<LogicalType> &requested_types) {
+	// we only cache the results for files that we can check for modifications (i.e. not for pipes or compressed files)
+	if (!ObjectCache::ObjectCacheEnabled(context) || !file_handle->CanSeek()) {
+		return SniffCSV(requested_types);
+	}
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto cache_key = CSVSniffCache::ObjectType() + ":" + options.file_path;
+	auto fingerprint = SniffOptionsFingerprint(options, requested_types);
+	auto file_size = file_handle->FileSize();
+	auto last_modified = file_handle->LastModifiedTime();
+
+	auto entry = cache.Get<CSVSniffCache>(cache_key);
+	if (entry && entry->IsValid(fingerprint, file_size, last_modified)) {
+		options = entry->options;
+		names = entry->names;
+		PrepareComplexParser();
+		return entry->return_types;
+	}
+	auto detected_types = SniffCSV(requested_types);
+	if (!detected_types.empty()) {
+		cache.Put(cache_key, make_shared<CSVSniffCache>(std::move(fingerprint), file_size, last_modified,
+		                                                time(nullptr), options, detected_types, names));
+	}
+	return detected_types;
+}
+
 bool BufferedCSVReader::TryParseComplexCSV(DataChunk &insert_chunk, string &error_message) {
 	// used for parsing algorithm
 	bool finished_chunk = false;
@@ -930,6 +985,7 @@ bool BufferedCSVReader::TryParseComplexCSV(DataChunk &insert_chunk, string &erro
 	// read values into the buffer (if any)
 	if (position >= buffer_size) {
 		if (!ReadBuffer(start, line_start)) {
+			end_of_file_reached = true;
 			return true;
 		}
 	}
@@ -1189,11 +1245,15 @@ bool BufferedCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error
 	idx_t offset = 0;
 	bool has_quotes = false;
 	vector<idx_t> escape_positions;
+	// the characters that can end an unquoted or a quoted value
+	CSVCharacterScanner value_scanner(options.delimiter[0], options.delimiter[0], '\n', '\r');
+	CSVCharacterScanner quoted_scanner(options.quote[0], options.escape[0], options.quote[0], options.quote[0]);
 
 	idx_t line_start = position;
 	// read values into the buffer (if any)
 	if (position >= buffer_size) {
 		if (!ReadBuffer(start, line_start)) {
+			end_of_file_reached = true;
 			return true;
 		}
 	}
@@ -1218,6 +1278,7 @@ normal:
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	do {
+		position = value_scanner.Find(buffer.get(), position, buffer_size);
 		for (; position < buffer_size; position++) {
 			if (buffer[position] == options.delimiter[0]) {
 				// delimiter: end the value and add it to the chunk
@@ -1289,6 +1350,7 @@ in_quotes:
 	has_quotes = true;
 	position++;
 	do {
+		position = quoted_scanner.Find(buffer.get(), position, buffer_size);
 		for (; position < buffer_size; position++) {
 			if (buffer[position] == options.quote[0]) {
 				// quote: move to unquoted state
@@ -1476,6 +1538,9 @@ void BufferedCSVReader::ParseCSV(ParserMode mode) {
 
 bool BufferedCSVReader::TryParseCSV(ParserMode parser_mode, DataChunk &insert_chunk, string &error_message) {
 	mode = parser_mode;
+	if (mode == ParserMode::PARSING) {
+		InitializeProjectedColumns();
+	}
 
 	if (options.quote.size() <= 1 && options.escape.size() <= 1 && options.delimiter.size() == 1) {
 		return TryParseSimpleCSV(insert_chunk, error_message);
@@ -68,6 +68,10 @@ idx_t CSVFileHandle::FileSize() {
 	return file_size;
 }
 
+time_t CSVFileHandle::LastModifiedTime() {
+	return fs.GetLastModifiedTime(*file_handle);
+}
+
 bool CSVFileHandle::FinishedReading() {
 	return requested_bytes >= file_size;
 }
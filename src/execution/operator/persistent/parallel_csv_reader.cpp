@@ -157,10 +157,12 @@ bool ParallelCSVReader::SetPosition() {
 		idx_t position_set = position_buffer;
 		start_buffer = position_buffer;
 		// We check if we can add this line
-		// disable the projection pushdown while reading the first line
+		// disable the projection and filter pushdown while reading the first line
 		// otherwise the first line parsing can be influenced by which columns we are reading
 		auto column_ids = std::move(reader_data.column_ids);
 		auto column_mapping = std::move(reader_data.column_mapping);
+		auto filters = reader_data.filters;
+		reader_data.filters = nullptr;
 		InitializeProjection();
 		try {
 			successfully_read_first_line = TryParseSimpleCSV(first_line_chunk, error_message, true);
@@ -170,6 +172,8 @@ bool ParallelCSVReader::SetPosition() {
 		// restore the projection pushdown
 		reader_data.column_ids = std::move(column_ids);
 		reader_data.column_mapping = std::move(column_mapping);
+		reader_data.filters = filters;
+		InitializeProjectedColumns();
 		end_buffer = end_buffer_real;
 		start_buffer = position_set;
 		if (position_buffer >= end_buffer) {
@@ -299,6 +303,11 @@ bool ParallelCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error
 	bool has_quotes = false;
 
 	vector<idx_t> escape_positions;
+	// the characters that can end an unquoted value (quotes are only relevant when trying to add a line)
+	CSVCharacterScanner value_scanner(options.delimiter[0], try_add_line ? options.quote[0] : options.delimiter[0],
+	                                  '\n', '\r');
+	// the characters that can end a quoted value
+	CSVCharacterScanner quoted_scanner(options.quote[0], options.escape[0], options.quote[0], options.quote[0]);
 	if ((start_buffer == buffer->buffer_start || start_buffer == buffer->buffer_end) && !try_add_line) {
 		// First time reading this buffer piece
 		if (!SetPosition()) {
@@ -339,6 +348,7 @@ value_start : {
 normal : {
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
+	position_buffer = buffer->FindSpecialCharacter(value_scanner, position_buffer, end_buffer);
 	for (; position_buffer < end_buffer; position_buffer++) {
 		auto c = (*buffer)[position_buffer];
 		if (c == options.delimiter[0]) {
@@ -465,6 +475,7 @@ in_quotes:
 	/* state: in_quotes this state parses the remainder of a quoted value*/
 	has_quotes = true;
 	position_buffer++;
+	position_buffer = buffer->FindSpecialCharacter(quoted_scanner, position_buffer, end_buffer);
 	for (; position_buffer < end_buffer; position_buffer++) {
 		auto c = (*buffer)[position_buffer];
 		if (c == options.quote[0]) {
@@ -569,7 +580,8 @@ final_state : {
 				finished = true;
 			}
 		}
-		buffer->lines_read += insert_chunk.size();
+		buffer->lines_read += insert_chunk.size() + filtered_row_count;
+		filtered_row_count = 0;
 		return true;
 	}
 	// If this is the last buffer, we have to read the last value
@@ -603,7 +615,8 @@ final_state : {
 	// flush the parsed chunk and finalize parsing
 	if (mode == ParserMode::PARSING) {
 		Flush(insert_chunk, buffer->local_batch_index);
-		buffer->lines_read += insert_chunk.size();
+		buffer->lines_read += insert_chunk.size() + filtered_row_count;
+		filtered_row_count = 0;
 	}
 	if (position_buffer - verification_positions.end_of_last_line > options.buffer_size) {
 		error_message = "Line does not fit in one buffer. Increase the buffer size.";
@@ -661,6 +674,9 @@ void ParallelCSVReader::ParseCSV(ParserMode mode) {
 
 bool ParallelCSVReader::TryParseCSV(ParserMode parser_mode, DataChunk &insert_chunk, string &error_message) {
 	mode = parser_mode;
+	if (mode == ParserMode::PARSING) {
+		InitializeProjectedColumns();
+	}
 	return TryParseSimpleCSV(insert_chunk, error_message);
 }
 
@@ -56,11 +56,19 @@ public:
 	TableScanLocalSourceState(ExecutionContext &context, TableScanGlobalSourceState &gstate,
 	                          const PhysicalTableScan &op) {
 		if (op.function.init_local) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			optional_ptr<TableFilterSet> filters = op.table_filters.get();
+			if (op.dynamic_filters && op.dynamic_filters->HasFilters()) {
+				// filters were pushed into this scan during execution: scan with those as well
+				table_filters = op.dynamic_filters->GetFinalTableFilters(filters);
+				filters = table_filters.get();
+			}
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, filters);
 			local_state = op.function.init_local(context, input, gstate.global_state.get());
 		}
 	}
 
+	//! The table filters of this scan, if any were pushed during execution (referenced by the local state)
+	unique_ptr<TableFilterSet> table_filters;
 	unique_ptr<LocalTableFunctionState> local_state;
 };
 
@@ -42,6 +42,11 @@ public:
 	vector<ARTKey> keys;
 	DataChunk key_chunk;
 	vector<column_t> key_column_ids;
+
+	//! The (sorted) keys of the current batch
+	vector<ARTKey> batch_keys;
+	//! The row identifiers of the current batch
+	vector<row_t> batch_row_ids;
 };
 
 unique_ptr<GlobalSinkState> PhysicalCreateIndex::GetGlobalSinkState(ClientContext &context) const {
@@ -84,6 +89,24 @@ unique_ptr<LocalSinkState> PhysicalCreateIndex::GetLocalSinkState(ExecutionConte
 	return std::move(state);
 }
 
+static void ConstructBatchIndex(CreateIndexLocalSinkState &lstate) {
+	if (lstate.batch_keys.empty()) {
+		return;
+	}
+
+	// the keys of a batch are sorted: construct its subtree bottom-up, and merge it into the local ART
+	// the batches cover disjoint key ranges, so the merge only touches the nodes on the boundaries of the key ranges
+	auto &art = lstate.local_index->Cast<ART>();
+	Vector row_identifiers(LogicalType::ROW_TYPE, data_ptr_cast(lstate.batch_row_ids.data()));
+	if (!art.ConstructFromSorted(lstate.batch_keys.size(), lstate.batch_keys, row_identifiers)) {
+		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	}
+
+	lstate.batch_keys.clear();
+	lstate.batch_row_ids.clear();
+	lstate.arena_allocator.Reset();
+}
+
 SinkResultType PhysicalCreateIndex::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 
 	D_ASSERT(chunk.ColumnCount() >= 2);
@@ -91,29 +114,34 @@ SinkResultType PhysicalCreateIndex::Sink(ExecutionContext &context, DataChunk &c
 	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
 
 	// generate the keys for the given input
+	// the keys of the batch are allocated in the arena allocator until the ART of the batch has been constructed
 	lstate.key_chunk.ReferenceColumns(chunk, lstate.key_column_ids);
-	lstate.arena_allocator.Reset();
 	ART::GenerateKeys(lstate.arena_allocator, lstate.key_chunk, lstate.keys);
 
-	auto &storage = table.GetStorage();
-	auto art = make_uniq<ART>(lstate.local_index->column_ids, lstate.local_index->table_io_manager,
-	                          lstate.local_index->unbound_expressions, lstate.local_index->constraint_type, storage.db);
-	if (!art->ConstructFromSorted(lstate.key_chunk.size(), lstate.keys, row_identifiers)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
-	}
+	row_identifiers.Flatten(chunk.size());
+	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+	lstate.batch_keys.insert(lstate.batch_keys.end(), lstate.keys.begin(), lstate.keys.begin() + chunk.size());
+	lstate.batch_row_ids.insert(lstate.batch_row_ids.end(), row_ids, row_ids + chunk.size());
 
-	// merge into the local ART
-	if (!lstate.local_index->MergeIndexes(*art)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	if (!lstate.partition_info.batch_index.IsValid()) {
+		// we do not know which chunks belong to the same batch: construct the ART of every chunk separately
+		ConstructBatchIndex(lstate);
 	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+void PhysicalCreateIndex::NextBatch(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                    LocalSinkState &lstate_p) const {
+	auto &lstate = lstate_p.Cast<CreateIndexLocalSinkState>();
+	ConstructBatchIndex(lstate);
+}
+
 void PhysicalCreateIndex::Combine(ExecutionContext &context, GlobalSinkState &gstate_p,
                                   LocalSinkState &lstate_p) const {
 
 	auto &gstate = gstate_p.Cast<CreateIndexGlobalSinkState>();
 	auto &lstate = lstate_p.Cast<CreateIndexLocalSinkState>();
+	ConstructBatchIndex(lstate);
 
 	// merge the local index into the global index
 	if (!gstate.global_index->MergeIndexes(*lstate.local_index)) {
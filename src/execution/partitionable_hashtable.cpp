@@ -21,7 +21,8 @@ PartitionableHashTable::PartitionableHashTable(ClientContext &context, Allocator
                                                vector<BoundAggregateExpression *> bindings_p)
     : context(context), allocator(allocator), group_types(std::move(group_types_p)),
       payload_types(std::move(payload_types_p)), bindings(std::move(bindings_p)), is_partitioned(false),
-      partition_info(partition_info_p), hashes(LogicalType::HASH), hashes_subset(LogicalType::HASH) {
+      is_pass_through(false), sampled_rows(0), sampled_groups(0), partition_info(partition_info_p),
+      hashes(LogicalType::HASH), hashes_subset(LogicalType::HASH) {
 
 	sel_vectors.resize(partition_info.n_partitions);
 	sel_vector_sizes.resize(partition_info.n_partitions);
@@ -33,35 +34,45 @@ PartitionableHashTable::PartitionableHashTable(ClientContext &context, Allocator
 	for (hash_t r = 0; r < partition_info.n_partitions; r++) {
 		sel_vectors[r].Initialize();
 	}
-
-	RowLayout layout;
-	layout.Initialize(group_types, AggregateObject::CreateAggregateObjects(bindings));
-	tuple_size = layout.GetRowWidth();
 }
 
-HtEntryType PartitionableHashTable::GetHTEntrySize() {
-	// we need at least STANDARD_VECTOR_SIZE entries to fit in the hash table
-	if (GroupedAggregateHashTable::GetMaxCapacity(HtEntryType::HT_WIDTH_32, tuple_size) < STANDARD_VECTOR_SIZE) {
-		return HtEntryType::HT_WIDTH_64;
+idx_t PartitionableHashTable::ListAddChunk(HashTableList &list, DataChunk &groups, Vector &group_hashes,
+                                           DataChunk &payload, const unsafe_vector<idx_t> &filter) {
+	// the HT resizes itself as it grows, so we only need to create one if there is none yet
+	if (list.empty()) {
+		list.push_back(make_uniq<GroupedAggregateHashTable>(context, allocator, group_types, payload_types, bindings));
 	}
-	return HtEntryType::HT_WIDTH_32;
+	return list.back()->AddChunk(append_state, groups, group_hashes, payload, filter);
 }
 
-idx_t PartitionableHashTable::ListAddChunk(HashTableList &list, DataChunk &groups, Vector &group_hashes,
-                                           DataChunk &payload, const unsafe_vector<idx_t> &filter) {
-	// If this is false, a single AddChunk would overflow the max capacity
-	D_ASSERT(list.empty() || groups.size() <= list.back()->MaxCapacity());
-	if (list.empty() || list.back()->Count() + groups.size() >= list.back()->MaxCapacity()) {
-		idx_t new_capacity = GroupedAggregateHashTable::InitialCapacity();
+idx_t PartitionableHashTable::PassThroughAddChunk(HashTableList &list, DataChunk &groups, Vector &group_hashes,
+                                                  DataChunk &payload, const unsafe_vector<idx_t> &filter) {
+	// the HTs that were created before switching to pass-through have been finalized, and we added a new one
+	D_ASSERT(!list.empty());
+	return list.back()->AddChunkPassThrough(append_state, groups, group_hashes, payload, filter);
+}
+
+void PartitionableHashTable::UpdatePassThrough(idx_t row_count, idx_t new_group_count) {
+	D_ASSERT(IsPartitioned() && !IsPassThrough());
+	sampled_rows += row_count;
+	sampled_groups += new_group_count;
+	if (sampled_rows < PASS_THROUGH_CHECK_INTERVAL) {
+		return;
+	}
+	if (double(sampled_groups) < double(sampled_rows) * PASS_THROUGH_THRESHOLD) {
+		// pre-aggregation pays off, check again later
+		sampled_rows = 0;
+		sampled_groups = 0;
+		return;
+	}
+	// (almost) every row creates a new group: stop probing the HTs, and only partition the rows from now on
+	for (auto &list : radix_partitioned_hts) {
 		if (!list.empty()) {
-			new_capacity = list.back()->Capacity();
-			// early release first part of ht and prevent adding of more data
 			list.back()->Finalize();
 		}
-		list.push_back(make_uniq<GroupedAggregateHashTable>(context, allocator, group_types, payload_types, bindings,
-		                                                    GetHTEntrySize(), new_capacity));
+		list.push_back(make_uniq<GroupedAggregateHashTable>(context, allocator, group_types, payload_types, bindings));
 	}
-	return list.back()->AddChunk(append_state, groups, group_hashes, payload, filter);
+	is_pass_through = true;
 }
 
 idx_t PartitionableHashTable::AddChunk(DataChunk &groups, DataChunk &payload, bool do_partition,
@@ -112,7 +123,16 @@ idx_t PartitionableHashTable::AddChunk(DataChunk &groups, DataChunk &payload, bo
 		}
 		hashes_subset.Slice(hashes, sel_vectors[r], sel_vector_sizes[r]);
 
-		group_count += ListAddChunk(radix_partitioned_hts[r], group_subset, hashes_subset, payload_subset, filter);
+		if (IsPassThrough()) {
+			group_count +=
+			    PassThroughAddChunk(radix_partitioned_hts[r], group_subset, hashes_subset, payload_subset, filter);
+		} else {
+			group_count +=
+			    ListAddChunk(radix_partitioned_hts[r], group_subset, hashes_subset, payload_subset, filter);
+		}
+	}
+	if (!IsPassThrough()) {
+		UpdatePassThrough(groups.size(), group_count);
 	}
 	return group_count;
 }
@@ -126,8 +146,8 @@ void PartitionableHashTable::Partition() {
 	radix_partitioned_hts.resize(partition_info.n_partitions);
 	for (auto &unpartitioned_ht : unpartitioned_hts) {
 		for (idx_t r = 0; r < partition_info.n_partitions; r++) {
-			radix_partitioned_hts[r].push_back(make_uniq<GroupedAggregateHashTable>(
-			    context, allocator, group_types, payload_types, bindings, GetHTEntrySize()));
+			radix_partitioned_hts[r].push_back(
+			    make_uniq<GroupedAggregateHashTable>(context, allocator, group_types, payload_types, bindings));
 			partition_hts[r] = radix_partitioned_hts[r].back().get();
 		}
 		unpartitioned_ht->Partition(partition_hts, partition_info.radix_bits);
@@ -141,6 +161,10 @@ bool PartitionableHashTable::IsPartitioned() {
 	return is_partitioned;
 }
 
+bool PartitionableHashTable::IsPassThrough() {
+	return is_pass_through;
+}
+
 HashTableList PartitionableHashTable::GetPartition(idx_t partition) {
 	D_ASSERT(IsPartitioned());
 	D_ASSERT(partition < partition_info.n_partitions);
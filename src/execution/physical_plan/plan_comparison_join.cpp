@@ -229,6 +229,25 @@ static bool PlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op, uni
 	return false;
 }
 
+static vector<JoinFilterPushdownColumn> PlanJoinFilterPushdown(LogicalComparisonJoin &op) {
+	// the physical join moves the equality conditions to the front: remap the condition indexes accordingly
+	vector<JoinFilterPushdownColumn> result;
+	for (auto &pushdown_column : op.filter_pushdown) {
+		D_ASSERT(op.conditions[pushdown_column.join_condition].comparison == ExpressionType::COMPARE_EQUAL);
+		idx_t equality_index = 0;
+		for (idx_t cond_idx = 0; cond_idx < pushdown_column.join_condition; cond_idx++) {
+			auto comparison = op.conditions[cond_idx].comparison;
+			if (comparison == ExpressionType::COMPARE_EQUAL ||
+			    comparison == ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+				equality_index++;
+			}
+		}
+		result.push_back(pushdown_column);
+		result.back().join_condition = equality_index;
+	}
+	return result;
+}
+
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	if (expr.type == ExpressionType::BOUND_REF) {
 		auto &ref = expr.Cast<BoundReferenceExpression>();
@@ -287,9 +306,12 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalComparison
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
-		                                   op.join_type, op.left_projection_map, op.right_projection_map,
-		                                   std::move(op.delim_types), op.estimated_cardinality, perfect_join_stats);
+		auto filter_pushdown = PlanJoinFilterPushdown(op);
+		auto hash_join = make_uniq<PhysicalHashJoin>(
+		    op, std::move(left), std::move(right), std::move(op.conditions), op.join_type, op.left_projection_map,
+		    op.right_projection_map, std::move(op.delim_types), op.estimated_cardinality, perfect_join_stats);
+		hash_join->filter_pushdown = std::move(filter_pushdown);
+		plan = std::move(hash_join);
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
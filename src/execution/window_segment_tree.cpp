@@ -6,6 +6,38 @@
 
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// WindowAggregateLocalState
+//===--------------------------------------------------------------------===//
+
+WindowAggregateLocalState::WindowAggregateLocalState(const AggregateObject &aggr)
+    : aggr(aggr), state(aggr.function.state_size()), statev(Value::POINTER(CastPointerToValue(state.data()))),
+      statep(Value::POINTER(CastPointerToValue(state.data()))), sel(STANDARD_VECTOR_SIZE), frame(0, 0),
+      window_state(false), partition(0) {
+	statep.Flatten(STANDARD_VECTOR_SIZE);
+	statev.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
+}
+
+WindowAggregateLocalState::~WindowAggregateLocalState() {
+	if (window_state && aggr.function.destructor) {
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+		aggr.function.destructor(statev, aggr_input_data, 1);
+	}
+}
+
+void WindowAggregateLocalState::AggregateInit() {
+	aggr.function.initialize(state.data());
+}
+
+void WindowAggregateLocalState::AggegateFinal(Vector &result, idx_t rid) {
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+	aggr.function.finalize(statev, aggr_input_data, result, 1, rid);
+
+	if (aggr.function.destructor) {
+		aggr.function.destructor(statev, aggr_input_data, 1);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // WindowAggregateState
 //===--------------------------------------------------------------------===//
@@ -39,7 +71,12 @@ void WindowAggregateState::Sink(DataChunk &payload_chunk, SelectionVector *filte
 void WindowAggregateState::Finalize() {
 }
 
-void WindowAggregateState::Compute(Vector &result, idx_t rid, idx_t start, idx_t end) {
+unique_ptr<WindowAggregateLocalState> WindowAggregateState::GetLocalState() const {
+	return make_uniq<WindowAggregateLocalState>(aggr);
+}
+
+void WindowAggregateState::Compute(WindowAggregateLocalState &lstate, Vector &result, idx_t rid, idx_t start,
+                                   idx_t end) const {
 }
 
 //===--------------------------------------------------------------------===//
@@ -165,17 +202,123 @@ void WindowConstantAggregate::Finalize() {
 	row = 0;
 }
 
-void WindowConstantAggregate::Compute(Vector &target, idx_t rid, idx_t start, idx_t end) {
+void WindowConstantAggregate::Compute(WindowAggregateLocalState &lstate, Vector &target, idx_t rid, idx_t start,
+                                      idx_t end) const {
 	//	Find the partition containing [start, end)
-	while (start < partition_offsets[partition] || partition_offsets[partition + 1] <= start) {
-		++partition;
+	//	Local states can start reading in any partition, so search for it if it is not the current one
+	auto &partition_idx = lstate.partition;
+	if (start < partition_offsets[partition_idx] || partition_offsets[partition_idx + 1] <= start) {
+		const auto next = std::upper_bound(partition_offsets.begin(), partition_offsets.end(), start);
+		partition_idx = (next - partition_offsets.begin()) - 1;
 	}
-	D_ASSERT(partition_offsets[partition] <= start);
-	D_ASSERT(partition + 1 < partition_offsets.size());
-	D_ASSERT(end <= partition_offsets[partition + 1]);
+	D_ASSERT(partition_offsets[partition_idx] <= start);
+	D_ASSERT(partition_idx + 1 < partition_offsets.size());
+	D_ASSERT(end <= partition_offsets[partition_idx + 1]);
 
 	// Copy the value
-	VectorOperations::Copy(*results, target, partition + 1, partition, rid);
+	VectorOperations::Copy(*results, target, partition_idx + 1, partition_idx, rid);
+}
+
+//===--------------------------------------------------------------------===//
+// WindowDistinctAggregate
+//===--------------------------------------------------------------------===//
+WindowDistinctAggregate::WindowDistinctAggregate(AggregateObject aggr, const LogicalType &result_type,
+                                                 ClientContext &context, DataChunk *input,
+                                                 const ValidityMask &filter_mask_p, WindowAggregationMode mode_p)
+    : WindowAggregateState(std::move(aggr), result_type), input_ref(input), filter_mask(filter_mask_p), mode(mode_p),
+      addresses(LogicalType::POINTER), row(0) {
+	D_ASSERT(input_ref && input_ref->ColumnCount() > 0);
+	ht = make_uniq<GroupedAggregateHashTable>(context, Allocator::Get(context), input_ref->GetTypes());
+}
+
+WindowDistinctAggregate::~WindowDistinctAggregate() {
+}
+
+bool WindowDistinctAggregate::IsCount() const {
+	return aggr.function.name == "count" && input_ref->ColumnCount() == 1;
+}
+
+void WindowDistinctAggregate::Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) {
+	const auto count = payload_chunk.size();
+	if (!count) {
+		return;
+	}
+
+	// Locate the distinct value of every row
+	ht->FindOrCreateGroups(append_state, payload_chunk, addresses);
+	const auto group_ptrs = FlatVector::GetData<data_ptr_t>(addresses);
+
+	// COUNT ignores NULLs, so they can't be counted by the tree
+	UnifiedVectorFormat vdata;
+	const auto skip_nulls = IsCount();
+	if (skip_nulls) {
+		payload_chunk.data[0].ToUnifiedFormat(count, vdata);
+	}
+
+	prev_idcs.resize(row + count);
+	for (idx_t i = 0; i < count; ++i, ++row) {
+		auto &prev_idx = prev_idcs[row];
+		if (!filter_mask.RowIsValid(row) || (skip_nulls && !vdata.validity.RowIsValid(vdata.sel->get_index(i)))) {
+			prev_idx = NumericLimits<idx_t>::Maximum();
+			continue;
+		}
+		auto entry = last_idcs.find(group_ptrs[i]);
+		if (entry == last_idcs.end()) {
+			prev_idx = 0;
+			last_idcs[group_ptrs[i]] = row;
+		} else {
+			prev_idx = entry->second + 1;
+			entry->second = row;
+		}
+	}
+}
+
+void WindowDistinctAggregate::Finalize() {
+	// The distinct values are no longer needed
+	ht.reset();
+	last_idcs.clear();
+
+	if (IsCount() && mode == WindowAggregationMode::WINDOW) {
+		prev_tree = make_uniq<MergeSortTree<idx_t>>(std::move(prev_idcs));
+	}
+}
+
+void WindowDistinctAggregate::UpdateFrame(WindowAggregateLocalState &lstate, idx_t count) const {
+	if (!count) {
+		return;
+	}
+	auto &inputs = lstate.inputs;
+	if (!inputs.ColumnCount()) {
+		inputs.Initialize(Allocator::DefaultAllocator(), input_ref->GetTypes());
+	}
+	inputs.Slice(*input_ref, lstate.sel, count);
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+	aggr.function.update(inputs.data.data(), aggr_input_data, inputs.ColumnCount(), lstate.statep, count);
+}
+
+void WindowDistinctAggregate::Compute(WindowAggregateLocalState &lstate, Vector &result, idx_t rid, idx_t start,
+                                      idx_t end) const {
+	// Count the first occurrences of the values in the frame directly
+	if (prev_tree) {
+		auto rdata = FlatVector::GetData<int64_t>(result);
+		rdata[rid] = prev_tree->CountLess(start, end, start + 1);
+		return;
+	}
+
+	// Otherwise aggregate the first occurrences of the values in the frame
+	lstate.AggregateInit();
+	idx_t selected = 0;
+	for (auto i = start; i < end; ++i) {
+		if (prev_idcs[i] <= start) {
+			lstate.sel.set_index(selected++, i);
+			if (selected == STANDARD_VECTOR_SIZE) {
+				UpdateFrame(lstate, selected);
+				selected = 0;
+			}
+		}
+	}
+	UpdateFrame(lstate, selected);
+	lstate.AggegateFinal(result, rid);
 }
 
 //===--------------------------------------------------------------------===//
@@ -184,21 +327,19 @@ void WindowConstantAggregate::Compute(Vector &target, idx_t rid, idx_t start, id
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr_p, const LogicalType &result_type_p, DataChunk *input,
                                      const ValidityMask &filter_mask_p, WindowAggregationMode mode_p)
     : aggr(std::move(aggr_p)), result_type(result_type_p), state(aggr.function.state_size()),
-      statep(Value::POINTER(CastPointerToValue(state.data()))), frame(0, 0),
       statev(Value::POINTER(CastPointerToValue(state.data()))), internal_nodes(0), input_ref(input),
       filter_mask(filter_mask_p), mode(mode_p) {
-	statep.Flatten(input->size());
 	statev.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
 
 	if (input_ref && input_ref->ColumnCount() > 0) {
-		filter_sel.Initialize(input->size());
-		inputs.Initialize(Allocator::DefaultAllocator(), input_ref->GetTypes());
-		// if we have a frame-by-frame method, share the single state
-		if (aggr.function.window && UseWindowAPI()) {
-			AggregateInit();
-			inputs.Reference(*input_ref);
-		} else {
-			inputs.SetCapacity(*input_ref);
+		// if the aggregate can index the whole input for frame queries, build the index up front
+		// and share the single state between the threads
+		if (UseSharedState()) {
+			aggr.function.initialize(state.data());
+			AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+			aggr.function.window_init(input_ref->data.data(), filter_mask, aggr_input_data, input_ref->ColumnCount(),
+			                          state.data(), input_ref->size());
+		} else if (!aggr.function.window || !UseWindowAPI()) {
 			if (aggr.function.combine && UseCombineAPI()) {
 				ConstructTree();
 			}
@@ -227,28 +368,31 @@ WindowSegmentTree::~WindowSegmentTree() {
 		aggr.function.destructor(addresses, aggr_input_data, count);
 	}
 
-	if (aggr.function.window && UseWindowAPI()) {
+	if (UseSharedState() && input_ref && input_ref->ColumnCount() > 0) {
 		aggr.function.destructor(statev, aggr_input_data, 1);
 	}
 }
 
-void WindowSegmentTree::AggregateInit() {
-	aggr.function.initialize(state.data());
-}
-
-void WindowSegmentTree::AggegateFinal(Vector &result, idx_t rid) {
-	AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
-	aggr.function.finalize(statev, aggr_input_data, result, 1, rid);
-
-	if (aggr.function.destructor) {
-		aggr.function.destructor(statev, aggr_input_data, 1);
+unique_ptr<WindowAggregateLocalState> WindowSegmentTree::GetLocalState() const {
+	auto lstate = make_uniq<WindowAggregateLocalState>(aggr);
+	if (input_ref && input_ref->ColumnCount() > 0) {
+		auto &inputs = lstate->inputs;
+		inputs.Initialize(Allocator::DefaultAllocator(), input_ref->GetTypes());
+		// if we have a frame-by-frame method, each thread maintains its own incremental state
+		if (aggr.function.window && UseWindowAPI() && !UseSharedState()) {
+			lstate->AggregateInit();
+			lstate->window_state = true;
+			inputs.Reference(*input_ref);
+		}
 	}
+	return lstate;
 }
 
-void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
+void WindowSegmentTree::ExtractFrame(WindowAggregateLocalState &lstate, idx_t begin, idx_t end) const {
 	const auto size = end - begin;
 
 	auto &chunk = *input_ref;
+	auto &inputs = lstate.inputs;
 	const auto input_count = input_ref->ColumnCount();
 	inputs.SetCardinality(size);
 	for (idx_t i = 0; i < input_count; ++i) {
@@ -260,6 +404,7 @@ void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
 
 	// Slice to any filtered rows
 	if (!filter_mask.AllValid()) {
+		auto &filter_sel = lstate.sel;
 		idx_t filtered = 0;
 		for (idx_t i = begin; i < end; ++i) {
 			if (filter_mask.RowIsValid(i)) {
@@ -272,16 +417,18 @@ void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
 	}
 }
 
-void WindowSegmentTree::WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end) {
+void WindowSegmentTree::WindowSegmentValue(WindowAggregateLocalState &lstate, idx_t l_idx, idx_t begin,
+                                           idx_t end) const {
 	D_ASSERT(begin <= end);
+	auto &inputs = lstate.inputs;
 	if (begin == end || inputs.ColumnCount() == 0) {
 		return;
 	}
 
 	const auto count = end - begin;
-	Vector s(statep, 0, count);
+	Vector s(lstate.statep, 0, count);
 	if (l_idx == 0) {
-		ExtractFrame(begin, end);
+		ExtractFrame(lstate, begin, end);
 		AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
 		D_ASSERT(!inputs.data.empty());
 		aggr.function.update(&inputs.data[0], aggr_input_data, input_ref->ColumnCount(), s, inputs.size());
@@ -302,7 +449,11 @@ void WindowSegmentTree::WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end)
 
 void WindowSegmentTree::ConstructTree() {
 	D_ASSERT(input_ref);
-	D_ASSERT(inputs.ColumnCount() > 0);
+	D_ASSERT(input_ref->ColumnCount() > 0);
+
+	// Build the tree using a scratch state
+	WindowAggregateLocalState lstate(aggr);
+	lstate.inputs.Initialize(Allocator::DefaultAllocator(), input_ref->GetTypes());
 
 	// compute space required to store internal nodes of segment tree
 	internal_nodes = 0;
@@ -323,10 +474,10 @@ void WindowSegmentTree::ConstructTree() {
 	                                         : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
 		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
 			// compute the aggregate for this entry in the segment tree
-			AggregateInit();
-			WindowSegmentValue(level_current, pos, MinValue(level_size, pos + TREE_FANOUT));
+			lstate.AggregateInit();
+			WindowSegmentValue(lstate, level_current, pos, MinValue(level_size, pos + TREE_FANOUT));
 
-			memcpy(levels_flat_native.get() + (levels_flat_offset * state.size()), state.data(), state.size());
+			memcpy(levels_flat_native.get() + (levels_flat_offset * state.size()), lstate.state.data(), state.size());
 
 			levels_flat_offset++;
 		}
@@ -341,28 +492,34 @@ void WindowSegmentTree::ConstructTree() {
 	}
 }
 
-void WindowSegmentTree::Compute(Vector &result, idx_t rid, idx_t begin, idx_t end) {
+void WindowSegmentTree::Compute(WindowAggregateLocalState &lstate, Vector &result, idx_t rid, idx_t begin,
+                                idx_t end) const {
 	D_ASSERT(input_ref);
 
 	// If we have a window function, use that
 	if (aggr.function.window && UseWindowAPI()) {
 		// Frame boundaries
-		auto prev = frame;
-		frame = FrameBounds(begin, end);
+		auto prev = lstate.frame;
+		lstate.frame = FrameBounds(begin, end);
+
+		// The shared index state is only read by the window function
+		auto window_state = UseSharedState() ? data_ptr_cast(const_cast<data_t *>(state.data())) : lstate.state.data();
 
 		// Extract the range
 		AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
-		aggr.function.window(input_ref->data.data(), filter_mask, aggr_input_data, inputs.ColumnCount(), state.data(),
-		                     frame, prev, result, rid, 0);
+		aggr.function.window(input_ref->data.data(), filter_mask, aggr_input_data, input_ref->ColumnCount(),
+		                     window_state, lstate.frame, prev, result, rid, 0);
 		return;
 	}
 
-	AggregateInit();
+	lstate.AggregateInit();
 
-	// Aggregate everything at once if we can't combine states
+	// Aggregate the inputs a vector at a time if we can't combine states
 	if (!aggr.function.combine || !UseCombineAPI()) {
-		WindowSegmentValue(0, begin, end);
-		AggegateFinal(result, rid);
+		for (auto pos = begin; pos < end; pos += STANDARD_VECTOR_SIZE) {
+			WindowSegmentValue(lstate, 0, pos, MinValue<idx_t>(end, pos + STANDARD_VECTOR_SIZE));
+		}
+		lstate.AggegateFinal(result, rid);
 		return;
 	}
 
@@ -370,23 +527,23 @@ void WindowSegmentTree::Compute(Vector &result, idx_t rid, idx_t begin, idx_t en
 		idx_t parent_begin = begin / TREE_FANOUT;
 		idx_t parent_end = end / TREE_FANOUT;
 		if (parent_begin == parent_end) {
-			WindowSegmentValue(l_idx, begin, end);
+			WindowSegmentValue(lstate, l_idx, begin, end);
 			break;
 		}
 		idx_t group_begin = parent_begin * TREE_FANOUT;
 		if (begin != group_begin) {
-			WindowSegmentValue(l_idx, begin, group_begin + TREE_FANOUT);
+			WindowSegmentValue(lstate, l_idx, begin, group_begin + TREE_FANOUT);
 			parent_begin++;
 		}
 		idx_t group_end = parent_end * TREE_FANOUT;
 		if (end != group_end) {
-			WindowSegmentValue(l_idx, group_end, end);
+			WindowSegmentValue(lstate, l_idx, group_end, end);
 		}
 		begin = parent_begin;
 		end = parent_end;
 	}
 
-	AggegateFinal(result, rid);
+	lstate.AggegateFinal(result, rid);
 }
 
 } // namespace duckdb
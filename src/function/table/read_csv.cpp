@@ -255,9 +255,10 @@ struct ParallelCSVGlobalState : public GlobalTableFunctionState {
 public:
 	ParallelCSVGlobalState(ClientContext &context, unique_ptr<CSVFileHandle> file_handle_p,
 	                       const vector<string> &files_path_p, idx_t system_threads_p, idx_t buffer_size_p,
-	                       idx_t rows_to_skip, bool force_parallelism_p, vector<column_t> column_ids_p, bool has_header)
+	                       idx_t rows_to_skip, bool force_parallelism_p, vector<column_t> column_ids_p,
+	                       optional_ptr<TableFilterSet> filters_p, bool has_header)
 	    : file_handle(std::move(file_handle_p)), system_threads(system_threads_p), buffer_size(buffer_size_p),
-	      force_parallelism(force_parallelism_p), column_ids(std::move(column_ids_p)),
+	      force_parallelism(force_parallelism_p), column_ids(std::move(column_ids_p)), filters(filters_p),
 	      line_info(main_mutex, batch_to_tuple_end, tuple_start, tuple_end) {
 		file_handle->DisableReset();
 		current_file_path = files_path_p[0];
@@ -389,6 +390,8 @@ private:
 	idx_t running_threads = 0;
 	//! The column ids to read
 	vector<column_t> column_ids;
+	//! The filters pushed down into the scan
+	optional_ptr<TableFilterSet> filters;
 	//! Line Info used in error messages
 	LineInfo line_info;
 };
@@ -549,7 +552,7 @@ bool ParallelCSVGlobalState::Next(ClientContext &context, const ReadCSVData &bin
 		}
 		reader->options.file_path = current_file_path;
 		MultiFileReader::InitializeReader(*reader, bind_data.options.file_options, bind_data.reader_bind,
-		                                  bind_data.return_types, bind_data.return_names, column_ids, nullptr,
+		                                  bind_data.return_types, bind_data.return_names, column_ids, filters,
 		                                  bind_data.files.front());
 	} else {
 		// update the current reader
@@ -641,7 +644,7 @@ static unique_ptr<GlobalTableFunctionState> ParallelCSVInitGlobal(ClientContext
 	return make_uniq<ParallelCSVGlobalState>(
 	    context, std::move(file_handle), bind_data.files, context.db->NumberOfThreads(), bind_data.options.buffer_size,
 	    bind_data.options.skip_rows, ClientConfig::GetConfig(context).verify_parallelism, input.column_ids,
-	    bind_data.options.header && bind_data.options.has_header);
+	    input.filters, bind_data.options.header && bind_data.options.has_header);
 }
 
 //===--------------------------------------------------------------------===//
@@ -731,6 +734,8 @@ struct SingleThreadedCSVState : public GlobalTableFunctionState {
 	vector<string> csv_names;
 	//! The column ids to read
 	vector<column_t> column_ids;
+	//! The filters pushed down into the scan
+	optional_ptr<TableFilterSet> filters;
 
 	idx_t MaxThreads() const override {
 		return total_files;
@@ -780,7 +785,7 @@ private:
 				result->names = csv_names;
 			}
 			MultiFileReader::InitializeReader(*result, bind_data.options.file_options, bind_data.reader_bind,
-			                                  bind_data.return_types, bind_data.return_names, column_ids, nullptr,
+			                                  bind_data.return_types, bind_data.return_names, column_ids, filters,
 			                                  bind_data.files.front());
 		}
 		total_size = result->file_handle->FileSize();
@@ -840,6 +845,7 @@ static unique_ptr<GlobalTableFunctionState> SingleThreadedCSVInit(ClientContext
 		                                  input.filters, bind_data.files.front());
 	}
 	result->column_ids = input.column_ids;
+	result->filters = input.filters;
 
 	if (!bind_data.options.file_options.union_by_name) {
 		// if we are reading multiple files - run auto-detect only on the first file
@@ -885,6 +891,10 @@ static void SingleThreadedCSVFunction(ClientContext &context, TableFunctionInput
 			data.progress_in_files += current_progress - lstate.current_progress;
 			lstate.current_progress = current_progress;
 		}
+		if (output.size() == 0 && !lstate.csv_reader->end_of_file_reached) {
+			// all rows of the chunk were removed by the filters: continue reading this file
+			continue;
+		}
 		if (output.size() == 0) {
 			// exhausted this file, but we might have more files we can read
 			auto csv_reader = data.GetCSVReader(context, bind_data, lstate.file_index, lstate.total_size);
@@ -1158,6 +1168,7 @@ TableFunction ReadCSVTableFunction::GetFunction() {
 	read_csv.get_batch_index = CSVReaderGetBatchIndex;
 	read_csv.cardinality = CSVReaderCardinality;
 	read_csv.projection_pushdown = true;
+	read_csv.filter_pushdown = true;
 	ReadCSVAddNamedParameters(read_csv);
 	return read_csv;
 }
@@ -0,0 +1,82 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBCheckpointTimingsData : public GlobalTableFunctionState {
+	DuckDBCheckpointTimingsData() : index(0) {
+	}
+
+	idx_t index;
+	vector<reference<AttachedDatabase>> databases;
+};
+
+static unique_ptr<FunctionData> DuckDBCheckpointTimingsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                            vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("total");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("write_row_group_data");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("write_table_metadata");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("flush_partial_blocks");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("write_header");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("row_group_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("parallel");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBCheckpointTimingsInit(ClientContext &context,
+                                                                 TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBCheckpointTimingsData>();
+	result->databases = DatabaseManager::Get(context).GetDatabases(context);
+	return std::move(result);
+}
+
+void DuckDBCheckpointTimingsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBCheckpointTimingsData>();
+	idx_t row = 0;
+	for (; data.index < data.databases.size() && row < STANDARD_VECTOR_SIZE; data.index++) {
+		auto &db = data.databases[data.index].get();
+		if (db.IsSystem() || db.IsTemporary() || !db.GetCatalog().IsDuckCatalog()) {
+			continue;
+		}
+		auto timings = db.GetStorageManager().GetCheckpointTimings();
+		idx_t col = 0;
+		output.data[col++].SetValue(row, Value(db.GetName()));
+		output.data[col++].SetValue(row, Value::DOUBLE(timings.total));
+		output.data[col++].SetValue(row, Value::DOUBLE(timings.write_row_group_data));
+		output.data[col++].SetValue(row, Value::DOUBLE(timings.write_table_metadata));
+		output.data[col++].SetValue(row, Value::DOUBLE(timings.flush_partial_blocks));
+		output.data[col++].SetValue(row, Value::DOUBLE(timings.write_header));
+		output.data[col++].SetValue(row, Value::BIGINT(timings.row_group_count));
+		output.data[col++].SetValue(row, Value::BOOLEAN(timings.parallel));
+		row++;
+	}
+	output.SetCardinality(row);
+}
+
+void DuckDBCheckpointTimingsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_checkpoint_timings", {}, DuckDBCheckpointTimingsFunction,
+	                              DuckDBCheckpointTimingsBind, DuckDBCheckpointTimingsInit));
+}
+
+} // namespace duckdb
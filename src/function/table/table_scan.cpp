@@ -5,7 +5,10 @@
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
+#include "duckdb/parser/constraints/not_null_constraint.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -400,6 +403,250 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	});
 }
 
+//===--------------------------------------------------------------------===//
+// Index Order Scan
+//===--------------------------------------------------------------------===//
+//! Extracts the bounds of an index scan from a filter on the indexed column. Returns false if the filter cannot be
+//! expressed as bounds on the index
+static bool ExtractIndexBounds(TableFilter &filter, const LogicalType &type, Value &low_value,
+                               ExpressionType &low_comparison_type, Value &high_value,
+                               ExpressionType &high_comparison_type) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.constant.IsNull() || constant_filter.constant.type() != type) {
+			return false;
+		}
+		auto comparison_type = constant_filter.comparison_type;
+		bool is_lower_bound = comparison_type == ExpressionType::COMPARE_EQUAL ||
+		                      comparison_type == ExpressionType::COMPARE_GREATERTHAN ||
+		                      comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+		bool is_upper_bound = comparison_type == ExpressionType::COMPARE_EQUAL ||
+		                      comparison_type == ExpressionType::COMPARE_LESSTHAN ||
+		                      comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+		if ((!is_lower_bound && !is_upper_bound) || (is_lower_bound && !low_value.IsNull()) ||
+		    (is_upper_bound && !high_value.IsNull())) {
+			// not a range comparison, or more than one bound on the same side
+			return false;
+		}
+		if (is_lower_bound) {
+			low_value = constant_filter.constant;
+			low_comparison_type = comparison_type == ExpressionType::COMPARE_GREATERTHAN
+			                          ? ExpressionType::COMPARE_GREATERTHAN
+			                          : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+		}
+		if (is_upper_bound) {
+			high_value = constant_filter.constant;
+			high_comparison_type = comparison_type == ExpressionType::COMPARE_LESSTHAN
+			                           ? ExpressionType::COMPARE_LESSTHAN
+			                           : ExpressionType::COMPARE_LESSTHANOREQUALTO;
+		}
+		return true;
+	}
+	case TableFilterType::IS_NOT_NULL:
+		// NULL values are not stored in the index
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!ExtractIndexBounds(*child_filter, type, low_value, low_comparison_type, high_value,
+			                        high_comparison_type)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Returns the index on (only) the given column, if there is any
+static optional_ptr<Index> FindColumnIndex(DataTable &storage, column_t column_id) {
+	optional_ptr<Index> result;
+	storage.info->indexes.Scan([&](Index &index) {
+		if (index.column_ids.size() != 1 || index.column_ids[0] != column_id ||
+		    index.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		result = &index;
+		return true;
+	});
+	return result;
+}
+
+struct IndexOrderScanGlobalState : public GlobalTableFunctionState {
+	//! The index that is scanned
+	optional_ptr<Index> index;
+	unique_ptr<IndexScanState> index_state;
+	//! Whether or not the index has no more qualifying keys
+	bool index_finished = false;
+	//! The row ids of the keys scanned from the index, and the offset of the next row id to fetch
+	vector<row_t> result_ids;
+	idx_t result_offset = 0;
+	//! The amount of rows fetched using the index
+	idx_t fetched_rows = 0;
+
+	ColumnFetchState fetch_state;
+	//! The scan state of the transaction-local rows
+	TableScanState scan_state;
+	vector<storage_t> column_ids;
+
+	vector<idx_t> projection_ids;
+	//! The DataChunk containing all read columns (even filter columns that are immediately removed)
+	DataChunk all_columns;
+
+	bool CanRemoveFilterColumns() const {
+		return !projection_ids.empty();
+	}
+};
+
+static unique_ptr<GlobalTableFunctionState> IndexOrderScanInitGlobal(ClientContext &context,
+                                                                     TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
+	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
+	auto &storage = bind_data.table.GetStorage();
+	auto result = make_uniq<IndexOrderScanGlobalState>();
+
+	result->column_ids.reserve(input.column_ids.size());
+	for (auto &id : input.column_ids) {
+		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
+	}
+	storage.InitializeScan(transaction, result->scan_state, result->column_ids, input.filters.get());
+	if (input.CanRemoveFilterColumns()) {
+		result->projection_ids = input.projection_ids;
+		const auto &columns = bind_data.table.GetColumns();
+		vector<LogicalType> scanned_types;
+		for (const auto &col_idx : input.column_ids) {
+			if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+				scanned_types.emplace_back(LogicalType::ROW_TYPE);
+			} else {
+				scanned_types.push_back(columns.GetColumn(LogicalIndex(col_idx)).Type());
+			}
+		}
+		result->all_columns.Initialize(context, scanned_types);
+	}
+
+	auto index = FindColumnIndex(storage, bind_data.order_column);
+	if (!index) {
+		// the index was dropped after this scan was planned
+		auto &column = bind_data.table.GetColumns().GetColumn(LogicalIndex(bind_data.order_column));
+		throw TransactionException("Cannot scan table \"%s\" in the order of column \"%s\": its index no longer "
+		                           "exists, please re-run the query",
+		                           bind_data.table.name, column.Name());
+	}
+	// the filters of the scan are applied by scanning the index within the bounds of the filters
+	Value low_value, high_value;
+	auto low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
+	if (input.filters) {
+		for (auto &entry : input.filters->filters) {
+			if (input.column_ids[entry.first] != bind_data.order_column ||
+			    !ExtractIndexBounds(*entry.second, index->logical_types[0], low_value, low_comparison_type,
+			                        high_value, high_comparison_type)) {
+				throw InternalException("Index order scan with a filter that is not a bound on the index");
+			}
+		}
+	}
+	result->index = index;
+	result->index_state =
+	    index->InitializeOrderedScan(transaction, low_value, low_comparison_type, high_value, high_comparison_type);
+	return std::move(result);
+}
+
+static void IndexOrderScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
+	auto &state = data_p.global_state->Cast<IndexOrderScanGlobalState>();
+	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
+	auto &local_storage = LocalStorage::Get(transaction);
+	auto &storage = bind_data.table.GetStorage();
+
+	if (state.CanRemoveFilterColumns()) {
+		state.all_columns.Reset();
+	}
+	auto &result = state.CanRemoveFilterColumns() ? state.all_columns : output;
+	while (true) {
+		if (state.result_offset == state.result_ids.size()) {
+			// the keys are always scanned as a whole, so once enough rows are fetched none of the remaining rows in
+			// the index can be part of the Top-N anymore
+			if (state.index_finished || state.fetched_rows >= bind_data.order_limit) {
+				break;
+			}
+			state.result_ids.clear();
+			state.result_offset = 0;
+			auto max_count = MinValue<idx_t>(bind_data.order_limit - state.fetched_rows, STANDARD_VECTOR_SIZE);
+			state.index_finished =
+			    !state.index->ScanOrdered(transaction, storage, *state.index_state, max_count, state.result_ids);
+			continue;
+		}
+		// fetch the next rows in key order, skipping the rows that are not visible to this transaction
+		auto fetch_count = MinValue<idx_t>(state.result_ids.size() - state.result_offset, STANDARD_VECTOR_SIZE);
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.result_ids.data() + state.result_offset));
+		storage.Fetch(transaction, result, state.column_ids, row_ids, fetch_count, state.fetch_state);
+		state.result_offset += fetch_count;
+		state.fetched_rows += result.size();
+		if (result.size() > 0) {
+			break;
+		}
+	}
+	if (result.size() == 0) {
+		// the rows of the transaction-local storage are not part of the index
+		local_storage.Scan(state.scan_state.local_state, state.column_ids, result);
+	}
+	if (state.CanRemoveFilterColumns()) {
+		output.ReferenceColumns(state.all_columns, state.projection_ids);
+	}
+}
+
+bool TableScanFunction::PushdownIndexOrder(LogicalGet &get, column_t column_id, idx_t limit) {
+	if (!GetTableEntry(get.function, get.bind_data.get())) {
+		return false;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan || bind_data.is_create_index || column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return false;
+	}
+	auto &table = bind_data.table;
+	auto &storage = table.GetStorage();
+
+	// fetching rows through the index is only worth it if the Top-N requires a small part of the table
+	if (limit > MaxValue<idx_t>(STANDARD_VECTOR_SIZE, storage.info->cardinality / 100)) {
+		return false;
+	}
+	auto index = FindColumnIndex(storage, column_id);
+	if (!index) {
+		return false;
+	}
+
+	// all filters of the scan must be bounds on the indexed column
+	Value low_value, high_value;
+	auto low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
+	for (auto &entry : get.table_filters.filters) {
+		if (entry.first != column_id || !ExtractIndexBounds(*entry.second, index->logical_types[0], low_value,
+		                                                    low_comparison_type, high_value, high_comparison_type)) {
+			return false;
+		}
+	}
+	if (get.table_filters.filters.empty()) {
+		// NULL values are not stored in the index: the column can only contain NULL values if they are filtered
+		bool not_null = false;
+		for (auto &constraint : table.GetConstraints()) {
+			if (constraint->type == ConstraintType::NOT_NULL &&
+			    constraint->Cast<NotNullConstraint>().index == LogicalIndex(column_id)) {
+				not_null = true;
+			}
+		}
+		if (!not_null) {
+			return false;
+		}
+	}
+
+	bind_data.is_index_order_scan = true;
+	bind_data.order_column = column_id;
+	bind_data.order_limit = limit;
+	get.function = GetIndexOrderScanFunction();
+	return true;
+}
+
 string TableScanToString(const FunctionData *bind_data_p) {
 	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
 	string result = bind_data.table.name;
@@ -415,6 +662,9 @@ static void TableScanSerialize(FieldWriter &writer, const FunctionData *bind_dat
 	writer.WriteField<bool>(bind_data.is_create_index);
 	writer.WriteList<row_t>(bind_data.result_ids);
 	writer.WriteString(bind_data.table.schema.catalog.GetName());
+	writer.WriteField<bool>(bind_data.is_index_order_scan);
+	writer.WriteField<column_t>(bind_data.order_column);
+	writer.WriteField<idx_t>(bind_data.order_limit);
 }
 
 static unique_ptr<FunctionData> TableScanDeserialize(ClientContext &context, FieldReader &reader,
@@ -425,6 +675,9 @@ static unique_ptr<FunctionData> TableScanDeserialize(ClientContext &context, Fie
 	auto is_create_index = reader.ReadRequired<bool>();
 	auto result_ids = reader.ReadRequiredList<row_t>();
 	auto catalog_name = reader.ReadField<string>(INVALID_CATALOG);
+	auto is_index_order_scan = reader.ReadField<bool>(false);
+	auto order_column = reader.ReadField<column_t>(DConstants::INVALID_INDEX);
+	auto order_limit = reader.ReadField<idx_t>(0);
 
 	auto &catalog_entry = Catalog::GetEntry<TableCatalogEntry>(context, catalog_name, schema_name, table_name);
 	if (catalog_entry.type != CatalogType::TABLE_ENTRY) {
@@ -435,6 +688,9 @@ static unique_ptr<FunctionData> TableScanDeserialize(ClientContext &context, Fie
 	result->is_index_scan = is_index_scan;
 	result->is_create_index = is_create_index;
 	result->result_ids = std::move(result_ids);
+	result->is_index_order_scan = is_index_order_scan;
+	result->order_column = order_column;
+	result->order_limit = order_limit;
 	return std::move(result);
 }
 
@@ -456,6 +712,25 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	return scan_function;
 }
 
+TableFunction TableScanFunction::GetIndexOrderScanFunction() {
+	TableFunction scan_function("index_order_scan", {}, IndexOrderScanFunction);
+	scan_function.init_local = nullptr;
+	scan_function.init_global = IndexOrderScanInitGlobal;
+	scan_function.statistics = TableScanStatistics;
+	scan_function.dependency = TableScanDependency;
+	scan_function.cardinality = TableScanCardinality;
+	scan_function.pushdown_complex_filter = nullptr;
+	scan_function.to_string = TableScanToString;
+	scan_function.table_scan_progress = nullptr;
+	scan_function.get_batch_index = nullptr;
+	scan_function.projection_pushdown = true;
+	scan_function.filter_pushdown = true;
+	scan_function.filter_prune = true;
+	scan_function.serialize = TableScanSerialize;
+	scan_function.deserialize = TableScanDeserialize;
+	return scan_function;
+}
+
 TableFunction TableScanFunction::GetFunction() {
 	TableFunction scan_function("seq_scan", {}, TableScanFunc);
 	scan_function.init_local = TableScanInitLocal;
@@ -491,6 +766,7 @@ void TableScanFunction::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(std::move(table_scan_set));
 
 	set.AddFunction(GetIndexScanFunction());
+	set.AddFunction(GetIndexOrderScanFunction());
 }
 
 void BuiltinFunctions::RegisterTableScanFunctions() {
@@ -13,12 +13,14 @@
 namespace duckdb {
 
 enum class WindowAggregationMode : uint32_t {
-	//! Use the window aggregate API if available
+	//! Use the window aggregate API if available, and merge sort tree indexes for holistic aggregates
 	WINDOW = 0,
 	//! Don't use window, but use combine if available
 	COMBINE,
 	//! Don't use combine or window (compute each frame separately)
-	SEPARATE
+	SEPARATE,
+	//! Use the window aggregate API if available, but update each frame incrementally without an index
+	INCREMENTAL
 };
 
 } // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/types/column/column_data_consumer.hpp"
 #include "duckdb/common/types/column/partitioned_column_data.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
@@ -56,7 +57,7 @@ public:
 	void UpdateLocalPartition(GroupingPartition &local_partition, GroupingAppend &local_append);
 	void CombineLocalPartition(GroupingPartition &local_partition, GroupingAppend &local_append);
 
-	void BuildSortState(ColumnDataCollection &group_data, PartitionGlobalHashGroup &global_sort);
+	void BuildSortState(ColumnDataConsumer &group_data, PartitionGlobalHashGroup &global_sort);
 
 	ClientContext &context;
 	BufferManager &buffer_manager;
@@ -142,10 +143,18 @@ public:
 
 	PartitionGlobalSinkState &sink;
 	GroupDataPtr group_data;
+	//! Parallel scanner for sorting the group data
+	unique_ptr<ColumnDataConsumer> group_consumer;
 	PartitionGlobalHashGroup *hash_group;
 	GlobalSortState *global_sort;
 
 private:
+	//! The number of tasks to use for sorting the group data
+	idx_t PrepareTaskCount() const;
+	//! The number of tasks to use for a merge round
+	idx_t MergeTaskCount() const;
+
+	const idx_t num_threads;
 	mutable mutex lock;
 	PartitionSortStage stage;
 	idx_t total_tasks;
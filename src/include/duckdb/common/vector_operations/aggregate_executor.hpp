@@ -388,6 +388,15 @@ public:
 		    idata, ifilter, ivalid, aggr_input_data, *reinterpret_cast<STATE *>(state), frame, prev, result, rid, bias);
 	}
 
+	template <class STATE, class INPUT_TYPE, class OP>
+	static void UnaryWindowInit(Vector &input, const ValidityMask &ifilter, AggregateInputData &aggr_input_data,
+	                            data_ptr_t state, idx_t count) {
+		auto idata = FlatVector::GetData<const INPUT_TYPE>(input);
+		const auto &ivalid = FlatVector::Validity(input);
+		OP::template WindowInit<STATE, INPUT_TYPE>(idata, ifilter, ivalid, aggr_input_data,
+		                                           *reinterpret_cast<STATE *>(state), count);
+	}
+
 	template <class STATE_TYPE, class OP>
 	static void Destroy(Vector &states, AggregateInputData &aggr_input_data, idx_t count) {
 		auto sdata = FlatVector::GetData<STATE_TYPE *>(states);
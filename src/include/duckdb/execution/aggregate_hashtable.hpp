@@ -30,12 +30,9 @@ struct FlushMoveState;
 // two part hash table
 // hashes and payload
 // hashes layout:
-// [SALT][PAGE_NR][PAGE_OFFSET]
+// [SALT][POINTER]
 // [SALT] are the high bits of the hash value, e.g. 16 for 64 bit hashes
-// [PAGE_NR] is the buffer managed payload page index
-// [PAGE_OFFSET] is the logical entry offset into said payload page
-
-// NOTE: PAGE_NR and PAGE_OFFSET are reversed for 64 bit HTs because struct packing
+// [POINTER] is the pointer to the row in the payload, pointers use at most 48 bits
 
 // payload layout
 // [VALIDITY][GROUPS][HASH][PADDING][PAYLOAD]
@@ -44,19 +41,52 @@ struct FlushMoveState;
 // [HASH] is the hash data of the groups
 // [PADDING] is gunk data to align payload properly
 // [PAYLOAD] is the payload (i.e. the aggregate states)
-struct aggr_ht_entry_64 {
-	uint16_t salt;
-	uint16_t page_offset;
-	uint32_t page_nr; // this has to come last because alignment
-};
+struct aggr_ht_entry_t {
+public:
+	//! Upper 16 bits are salt
+	static constexpr const hash_t SALT_MASK = 0xFFFF000000000000;
+	//! Lower 48 bits are the pointer
+	static constexpr const hash_t POINTER_MASK = 0x0000FFFFFFFFFFFF;
 
-struct aggr_ht_entry_32 {
-	uint8_t salt;
-	uint8_t page_nr;
-	uint16_t page_offset;
-};
+	inline bool IsOccupied() const {
+		return value != 0;
+	}
 
-enum HtEntryType { HT_WIDTH_32, HT_WIDTH_64 };
+	inline data_ptr_t GetPointer() const {
+		D_ASSERT(IsOccupied());
+		return reinterpret_cast<data_ptr_t>(value & POINTER_MASK);
+	}
+
+	inline void SetPointer(const data_ptr_t &pointer) {
+		// Pointer shouldn't use upper bits
+		D_ASSERT((CastPointerToValue(pointer) & SALT_MASK) == 0);
+		// Value should have all 1's in the pointer area
+		D_ASSERT((value & POINTER_MASK) == POINTER_MASK);
+		// Set upper bits to 1 in pointer so the salt stays intact
+		value &= CastPointerToValue(pointer) | SALT_MASK;
+	}
+
+	inline hash_t GetSalt() const {
+		return value & SALT_MASK;
+	}
+
+	//! Marks the entry as occupied by a group with the given salt, the pointer is set later with SetPointer
+	inline void SetSalt(const hash_t &salt) {
+		// Shouldn't be occupied when we set this
+		D_ASSERT(!IsOccupied());
+		// Salt should only have upper bits set
+		D_ASSERT((salt & POINTER_MASK) == 0);
+		// Pointer bits are set to 1 so the entry is occupied, and SetPointer can clear them
+		value = salt | POINTER_MASK;
+	}
+
+	static inline hash_t ExtractSalt(const hash_t &hash) {
+		return hash & SALT_MASK;
+	}
+
+private:
+	hash_t value;
+};
 
 struct AggregateHTScanState {
 	mutex lock;
@@ -68,6 +98,8 @@ struct AggregateHTAppendState {
 
 	Vector ht_offsets;
 	Vector hash_salts;
+	//! The rows that still have to find their group, in this round of probing
+	SelectionVector remaining_sel;
 	SelectionVector group_compare_vector;
 	SelectionVector no_match_vector;
 	SelectionVector empty_vector;
@@ -89,11 +121,9 @@ public:
 public:
 	GroupedAggregateHashTable(ClientContext &context, Allocator &allocator, vector<LogicalType> group_types,
 	                          vector<LogicalType> payload_types, const vector<BoundAggregateExpression *> &aggregates,
-	                          HtEntryType entry_type = HtEntryType::HT_WIDTH_64,
 	                          idx_t initial_capacity = InitialCapacity());
 	GroupedAggregateHashTable(ClientContext &context, Allocator &allocator, vector<LogicalType> group_types,
 	                          vector<LogicalType> payload_types, vector<AggregateObject> aggregates,
-	                          HtEntryType entry_type = HtEntryType::HT_WIDTH_64,
 	                          idx_t initial_capacity = InitialCapacity());
 	GroupedAggregateHashTable(ClientContext &context, Allocator &allocator, vector<LogicalType> group_types);
 	~GroupedAggregateHashTable() override;
@@ -107,6 +137,11 @@ public:
 	idx_t AddChunk(AggregateHTAppendState &state, DataChunk &groups, Vector &group_hashes, DataChunk &payload,
 	               const unsafe_vector<idx_t> &filter);
 	idx_t AddChunk(AggregateHTAppendState &state, DataChunk &groups, DataChunk &payload, AggregateType filter);
+	//! Add the given data to the HT without looking up existing groups: every row becomes a new group. This is used
+	//! when pre-aggregation does not reduce the data, duplicate groups are merged when this HT is combined into
+	//! another one. After calling this, the HT can only be combined into another HT.
+	idx_t AddChunkPassThrough(AggregateHTAppendState &state, DataChunk &groups, Vector &group_hashes,
+	                          DataChunk &payload, const unsafe_vector<idx_t> &filter);
 
 	//! Scan the HT starting from the scan_position until the result and group
 	//! chunks are filled. scan_position will be updated by this function.
@@ -142,8 +177,6 @@ public:
 	}
 
 	idx_t ResizeThreshold();
-	idx_t MaxCapacity();
-	static idx_t GetMaxCapacity(HtEntryType entry_type, idx_t tuple_size);
 
 	void Partition(vector<GroupedAggregateHashTable *> &partition_hts, idx_t radix_bits);
 	void InitializeFirstPart();
@@ -151,30 +184,23 @@ public:
 	void Finalize();
 
 private:
-	HtEntryType entry_type;
-
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
-	//! Tuple width
-	idx_t tuple_size;
-	//! Tuples per block
-	idx_t tuples_per_block;
 	//! The data of the HT
 	unique_ptr<TupleDataCollection> data_collection;
 	TupleDataPinState td_pin_state;
-	vector<data_ptr_t> payload_hds_ptrs;
 
 	//! The hashes of the HT
 	BufferHandle hashes_hdl;
-	data_ptr_t hashes_hdl_ptr;
+	aggr_ht_entry_t *entries;
 	idx_t hash_offset; // Offset into the layout of the hash column
 
-	hash_t hash_prefix_shift;
-
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	hash_t bitmask;
 
 	bool is_finalized;
+	//! Whether rows were added with AddChunkPassThrough, i.e., the first part of the HT is no longer maintained
+	bool is_pass_through;
 
 	vector<ExpressionType> predicates;
 
@@ -186,21 +212,11 @@ private:
 
 	void Destroy();
 	void Verify();
-	template <class ENTRY>
-	void VerifyInternal();
 	//! Resize the HT to the specified size. Must be larger than the current size.
-	template <class ENTRY>
 	void Resize(idx_t size);
-	//! Initializes the first part of the HT
-	template <class ENTRY>
-	void InitializeHashes();
+	//! Updates the aggregate states of the rows in state.addresses with the payload
+	void UpdateAggregates(AggregateHTAppendState &state, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 	//! Does the actual group matching / creation
-	template <class ENTRY>
-	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes_v, Vector &addresses_v,
-	                                 SelectionVector &new_groups);
-	//! Updates payload_hds_ptrs with the new pointers (after appending to data_collection)
-	void UpdateBlockPointers();
-	template <class ENTRY>
 	idx_t FindOrCreateGroupsInternal(AggregateHTAppendState &state, DataChunk &groups, Vector &group_hashes,
 	                                 Vector &addresses, SelectionVector &new_groups);
 };
@@ -57,6 +57,14 @@ public:
 	//! and false otherwise
 	bool Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, const idx_t max_count,
 	          vector<row_t> &result_ids) override;
+	//! Initialize a scan of the index in key order, bounded by the low and high value (a NULL value means unbounded)
+	unique_ptr<IndexScanState> InitializeOrderedScan(const Transaction &transaction, const Value &low_value,
+	                                                 const ExpressionType low_expression_type, const Value &high_value,
+	                                                 const ExpressionType high_expression_type) override;
+	//! Performs an ordered scan on the index, appending the row IDs of the next keys in key order to result_ids.
+	//! Returns true if there are more keys to scan, and false otherwise
+	bool ScanOrdered(const Transaction &transaction, const DataTable &table, IndexScanState &state,
+	                 const idx_t max_count, vector<row_t> &result_ids) override;
 
 	//! Called when data is appended to the index. The lock obtained from InitializeLock must be held
 	PreservedError Append(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
@@ -69,7 +77,8 @@ public:
 	//! Insert a chunk of entries into the index
 	PreservedError Insert(IndexLock &lock, DataChunk &data, Vector &row_ids) override;
 
-	//! Construct an ART from a vector of sorted keys
+	//! Construct an ART from a vector of sorted keys. If the ART already contains keys, the keys are constructed into a
+	//! separate subtree, which is then merged into the existing tree
 	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_identifiers);
 
 	//! Search equal values and fetches the row IDs
@@ -40,6 +40,8 @@ public:
 	bool operator>=(const ARTKey &k) const;
 	//! Equal to operator
 	bool operator==(const ARTKey &k) const;
+	//! Copies the current key into the result
+	void Copy(vector<data_t> &result) const;
 
 private:
 	//! The current key position
@@ -61,17 +63,20 @@ public:
 	void FindMinimum(Node &node);
 	//! Goes to the lower bound of the tree
 	bool LowerBound(Node node, const ARTKey &key, const bool &is_inclusive);
+	//! Returns the number of row IDs in the current leaf
+	idx_t GetLeafCount() const;
 
 private:
-	//! Stack of iterator entries
+	//! Stack of iterator entries, i.e., the inner nodes on the path to the current leaf, and the key byte of the
+	//! child that the iterator descended into
 	stack<IteratorEntry> nodes;
 	//! Last visited leaf
 	Leaf *last_leaf = nullptr;
 
-	//! Go to the next node
+	//! Go to the next leaf
 	bool Next();
-	//! Push part of the key to the current key
-	void PushKey(const Node &node, const uint8_t byte);
+	//! Go to the leftmost leaf of the next child of the node at the top of the stack
+	bool FindNextLeaf();
 	//! Pop node from the stack of iterator entries
 	void PopNode();
 };
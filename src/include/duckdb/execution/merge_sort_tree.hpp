@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/merge_sort_tree.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/helper.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+
+//! A merge sort tree stores the elements of each level in runs of F^level elements,
+//! where each run contains the sorted elements of the corresponding range of the lowest level.
+//! This allows answering order statistic queries over ranges of the lowest level in O(log^2 n)
+//! see "Efficient Evaluation of Arbitrarily-Framed Holistic SQL Aggregates and Window Functions" (SIGMOD 2022)
+template <typename E = idx_t, idx_t F = 32>
+struct MergeSortTree {
+	using Elements = vector<E>;
+
+	static_assert(F >= 2 && (F & (F - 1)) == 0, "MergeSortTree fan-out must be a power of two");
+
+	explicit MergeSortTree(Elements &&lowest_level) {
+		const auto count = lowest_level.size();
+		tree.emplace_back(std::move(lowest_level));
+
+		// Each level merges F runs of the level below it, using a sequence of pairwise merges
+		Elements src;
+		Elements dst;
+		for (idx_t run_length = 1; run_length < count; run_length *= F) {
+			src = tree.back();
+			dst.resize(count);
+			const auto next_length = run_length * F;
+			for (idx_t width = run_length; width < next_length && width < count; width *= 2) {
+				for (idx_t lo = 0; lo < count; lo += 2 * width) {
+					const auto mid = MinValue(lo + width, count);
+					const auto hi = MinValue(lo + 2 * width, count);
+					std::merge(src.begin() + lo, src.begin() + mid, src.begin() + mid, src.begin() + hi,
+					           dst.begin() + lo);
+				}
+				src.swap(dst);
+			}
+			tree.emplace_back(std::move(src));
+		}
+	}
+
+	idx_t Count() const {
+		return tree[0].size();
+	}
+
+	const Elements &LowestLevel() const {
+		return tree[0];
+	}
+
+	//! Counts the elements with a value in [lower, upper)
+	idx_t CountRange(const E lower, const E upper) const {
+		const auto &elements = tree.back();
+		const auto begin = std::lower_bound(elements.begin(), elements.end(), lower);
+		return std::lower_bound(begin, elements.end(), upper) - begin;
+	}
+
+	//! Counts the elements in the positions [lower, upper) of the lowest level that are less than val
+	idx_t CountLess(idx_t lower, idx_t upper, const E val) const {
+		D_ASSERT(upper <= Count());
+		idx_t result = 0;
+		idx_t run_length = 1;
+		for (idx_t level = 0; lower < upper; ++level, run_length *= F) {
+			D_ASSERT(level < tree.size());
+			const auto &elements = tree[level];
+			const auto next_length = run_length * F;
+			// Both bounds are aligned with the runs of this level, so consume complete runs
+			// from the edges until they are aligned with the runs of the next level
+			for (; lower < upper && lower % next_length; lower += run_length) {
+				const auto begin = elements.begin() + lower;
+				result += std::lower_bound(begin, begin + run_length, val) - begin;
+			}
+			for (; lower < upper && upper % next_length; upper -= run_length) {
+				const auto begin = elements.begin() + (upper - run_length);
+				result += std::lower_bound(begin, begin + run_length, val) - begin;
+			}
+		}
+		return result;
+	}
+
+	//! Returns the n-th element (in the order of the lowest level) among the elements with a value in [lower, upper)
+	E SelectNth(const E lower, const E upper, idx_t n) const {
+		D_ASSERT(n < CountRange(lower, upper));
+		const auto count = Count();
+		idx_t run_begin = 0;
+		idx_t run_length = 1;
+		for (idx_t level = 1; level < tree.size(); ++level) {
+			run_length *= F;
+		}
+		// Descend into the child run containing the n-th element
+		for (idx_t level = tree.size() - 1; level > 0; --level) {
+			const auto &children = tree[level - 1];
+			const auto child_length = run_length / F;
+			const auto run_end = MinValue(run_begin + run_length, count);
+			for (auto child_begin = run_begin; child_begin < run_end; child_begin += child_length) {
+				const auto first = children.begin() + child_begin;
+				const auto last = children.begin() + MinValue(child_begin + child_length, count);
+				const auto begin = std::lower_bound(first, last, lower);
+				const auto matches = idx_t(std::lower_bound(begin, last, upper) - begin);
+				if (n < matches) {
+					run_begin = child_begin;
+					break;
+				}
+				n -= matches;
+			}
+			run_length = child_length;
+		}
+		return tree[0][run_begin];
+	}
+
+	//! The levels of the tree, starting with the unsorted lowest level
+	vector<Elements> tree;
+};
+
+} // namespace duckdb
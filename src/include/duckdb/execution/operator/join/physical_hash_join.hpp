@@ -14,9 +14,10 @@
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
 #include "duckdb/execution/physical_operator.hpp"
-#include "duckdb/planner/operator/logical_join.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
 
 namespace duckdb {
+class HashJoinGlobalSinkState;
 
 //! PhysicalHashJoin represents a hash loop join between two tables
 class PhysicalHashJoin : public PhysicalComparisonJoin {
@@ -44,6 +45,8 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! The probe-side table scans that are filtered on the min/max of the build-side keys (if any)
+	vector<JoinFilterPushdownColumn> filter_pushdown;
 
 public:
 	// Operator Interface
@@ -89,6 +92,10 @@ public:
 	bool ParallelSink() const override {
 		return true;
 	}
+
+private:
+	//! Push the min/max and Bloom filter of the build-side keys into the probe-side table scans
+	void PushJoinFilters(HashJoinGlobalSinkState &sink) const;
 };
 
 } // namespace duckdb
@@ -63,6 +63,12 @@ public:
 
 	ParserMode mode;
 
+	//! Whether or not the values of a column are read, the values of the other columns are skipped while parsing
+	//! If this is empty, the values of all columns are read
+	vector<bool> projected_columns;
+	//! The number of parsed rows that were removed by the pushed down filters
+	idx_t filtered_row_count = 0;
+
 public:
 	const string &GetFileName() {
 		return options.file_path;
@@ -81,6 +87,8 @@ public:
 
 	//! Initialize projection indices to select all columns
 	void InitializeProjection();
+	//! Marks the columns that are read by the projection, this has to be called before parsing the file
+	void InitializeProjectedColumns();
 
 protected:
 	//! Initializes the parse_chunk with varchar columns and aligns info with new number of cols
@@ -99,6 +107,13 @@ protected:
 	bool AddRow(DataChunk &insert_chunk, idx_t &column, string &error_message, idx_t buffer_idx = 0);
 	//! Finalizes a chunk, parsing all values that have been added so far and adding them to the insert_chunk
 	bool Flush(DataChunk &insert_chunk, idx_t buffer_idx = 0, bool try_add_line = false);
+	//! Converts the parsed values of the c-th projected column to the type of the insert_chunk
+	//! "sel" maps the rows of the parse_chunk to the rows that were parsed before filtering out rows
+	bool ConvertColumn(idx_t c, DataChunk &insert_chunk, idx_t buffer_idx, bool try_add_line,
+	                   bool &conversion_error_ignored, const SelectionVector &sel, idx_t parsed_count);
+	//! Converts the columns used in the pushed down filters and selects the rows that pass the filters
+	idx_t ApplyFilters(DataChunk &insert_chunk, idx_t buffer_idx, SelectionVector &sel, vector<bool> &converted,
+	                   bool &conversion_error_ignored);
 
 	unique_ptr<CSVFileHandle> OpenCSV(const BufferedCSVReaderOptions &options);
 
@@ -106,6 +106,8 @@ private:
 	bool TryParseComplexCSV(DataChunk &insert_chunk, string &error_message);
 	//! Sniffs CSV dialect and determines skip rows, header row, column types and column names
 	vector<LogicalType> SniffCSV(const vector<LogicalType> &requested_types);
+	//! Sniffs the CSV file, or reuses the result of sniffing the same file before if the object cache is enabled
+	vector<LogicalType> SniffCSVCached(const vector<LogicalType> &requested_types);
 
 	//! First phase of auto detection: detect CSV dialect (i.e. delimiter, quote rules, etc)
 	void DetectDialect(const vector<LogicalType> &requested_types, BufferedCSVReaderOptions &original_options,
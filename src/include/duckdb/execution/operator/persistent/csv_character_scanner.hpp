@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/persistent/csv_character_scanner.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/helper.hpp"
+
+namespace duckdb {
+
+//! Finds the next occurrence of one of (up to) four special characters in a CSV buffer
+//! The buffer is compared 8 bytes at a time (SIMD within a register), such that the parsing state machines only have
+//! to look at the characters that can end the state they are in (e.g. delimiters and newlines in an unquoted value)
+class CSVCharacterScanner {
+public:
+	CSVCharacterScanner(char c1, char c2, char c3, char c4) {
+		memset(special, 0, sizeof(special));
+		const char characters[] = {c1, c2, c3, c4};
+		for (idx_t i = 0; i < 4; i++) {
+			special[uint8_t(characters[i])] = true;
+			masks[i] = BROADCAST * uint8_t(characters[i]);
+		}
+	}
+
+	//! Returns the position of the first special character in [position, end) of the buffer, or end if there is none
+	//! (or position if it is past the end)
+	inline idx_t Find(const char *buffer, idx_t position, idx_t end) const {
+		for (; position + sizeof(uint64_t) <= end; position += sizeof(uint64_t)) {
+			auto word = Load<uint64_t>(const_data_ptr_cast(buffer + position));
+			if (HasZeroByte(word ^ masks[0]) | HasZeroByte(word ^ masks[1]) | HasZeroByte(word ^ masks[2]) |
+			    HasZeroByte(word ^ masks[3])) {
+				break;
+			}
+		}
+		for (; position < end; position++) {
+			if (special[uint8_t(buffer[position])]) {
+				return position;
+			}
+		}
+		return position;
+	}
+
+private:
+	static constexpr const uint64_t BROADCAST = 0x0101010101010101ULL;
+
+	//! Non-zero if (and only if) any of the bytes of the word is zero
+	static inline uint64_t HasZeroByte(uint64_t word) {
+		return (word - BROADCAST) & ~word & (BROADCAST << 7);
+	}
+
+	//! The special characters, broadcast to all bytes of a word
+	uint64_t masks[4];
+	//! Whether or not a character is special
+	bool special[256];
+};
+
+} // namespace duckdb
@@ -32,6 +32,7 @@ public:
 	bool OnDiskFile();
 
 	idx_t FileSize();
+	time_t LastModifiedTime();
 
 	bool FinishedReading();
 
@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/persistent/csv_sniff_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/persistent/csv_reader_options.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+//! CSVSniffCache holds the result of auto-detecting the dialect, header, column names and types of a CSV file, such
+//! that subsequent scans of the same (unmodified) file with the same options can skip sniffing altogether
+class CSVSniffCache : public ObjectCacheEntry {
+public:
+	CSVSniffCache(string options_fingerprint_p, idx_t file_size_p, time_t last_modified_p, time_t read_time_p,
+	              BufferedCSVReaderOptions options_p, vector<LogicalType> return_types_p, vector<string> names_p)
+	    : options_fingerprint(std::move(options_fingerprint_p)), file_size(file_size_p),
+	      last_modified(last_modified_p), read_time(read_time_p), options(std::move(options_p)),
+	      return_types(std::move(return_types_p)), names(std::move(names_p)) {
+	}
+
+	~CSVSniffCache() override = default;
+
+	//! The (serialized) options and requested types the file was sniffed with
+	string options_fingerprint;
+	//! The size of the file when it was sniffed
+	idx_t file_size;
+	//! The last modification time of the file when it was sniffed
+	time_t last_modified;
+	//! The time at which the file was sniffed
+	time_t read_time;
+
+	//! The sniffed options (dialect, header, date formats)
+	BufferedCSVReaderOptions options;
+	//! The detected column types
+	vector<LogicalType> return_types;
+	//! The detected column names
+	vector<string> names;
+
+public:
+	//! Whether or not the cached result can be used for a file with the given fingerprint, size and modification time
+	bool IsValid(const string &fingerprint, idx_t size, time_t modified) const {
+		// files that were modified shortly before they were sniffed might have been modified again within the
+		// granularity of the modification time, so we never trust those
+		return options_fingerprint == fingerprint && file_size == size && last_modified == modified &&
+		       last_modified + 10 < read_time;
+	}
+
+	static string ObjectType() {
+		return "csv_sniff";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+};
+
+} // namespace duckdb
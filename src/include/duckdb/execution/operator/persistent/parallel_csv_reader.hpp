@@ -12,6 +12,7 @@
 #include "duckdb/execution/operator/persistent/csv_reader_options.hpp"
 #include "duckdb/execution/operator/persistent/csv_file_handle.hpp"
 #include "duckdb/execution/operator/persistent/csv_buffer.hpp"
+#include "duckdb/execution/operator/persistent/csv_character_scanner.hpp"
 #include "duckdb/execution/operator/persistent/csv_line_info.hpp"
 
 #include <sstream>
@@ -52,6 +53,16 @@ struct CSVBufferRead {
 		return next_ptr[i - buffer->GetBufferSize()];
 	}
 
+	//! Returns the position of the first special character in [position, end), or the position at which scanning
+	//! stopped. Only the current buffer is scanned, the remainder in the next buffer is left to the caller.
+	idx_t FindSpecialCharacter(const CSVCharacterScanner &scanner, idx_t position, idx_t end) const {
+		auto scan_end = MinValue<idx_t>(end, buffer->GetBufferSize());
+		if (position >= scan_end) {
+			return position;
+		}
+		return scanner.Find(buffer->Ptr(), position, scan_end);
+	}
+
 	string_t GetValue(idx_t start_buffer, idx_t position_buffer, idx_t offset) {
 		idx_t length = position_buffer - start_buffer - offset;
 		// 1) It's all in the current buffer
@@ -54,6 +54,7 @@ public:
 
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	void Combine(ExecutionContext &context, GlobalSinkState &gstate_p, LocalSinkState &lstate_p) const override;
+	void NextBatch(ExecutionContext &context, GlobalSinkState &gstate_p, LocalSinkState &lstate_p) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          GlobalSinkState &gstate) const override;
 
@@ -63,5 +64,10 @@ public:
 	bool ParallelSink() const override {
 		return true;
 	}
+	//! The input is sorted, and every batch covers a contiguous range of keys: we construct the index of each batch
+	//! at once
+	bool RequiresBatchIndex() const override {
+		return true;
+	}
 };
 } // namespace duckdb
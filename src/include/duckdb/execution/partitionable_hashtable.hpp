@@ -27,6 +27,11 @@ struct RadixPartitionInfo {
 typedef vector<unique_ptr<GroupedAggregateHashTable>> HashTableList; // NOLINT
 
 class PartitionableHashTable {
+	//! Number of partitioned rows after which we check whether pre-aggregation reduces the data
+	static constexpr const idx_t PASS_THROUGH_CHECK_INTERVAL = 131072;
+	//! Switch to pass-through if more than this fraction of the rows created a new group
+	static constexpr const double PASS_THROUGH_THRESHOLD = 0.95;
+
 public:
 	PartitionableHashTable(ClientContext &context, Allocator &allocator, RadixPartitionInfo &partition_info_p,
 	                       vector<LogicalType> group_types_p, vector<LogicalType> payload_types_p,
@@ -35,6 +40,8 @@ public:
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, bool do_partition, const unsafe_vector<idx_t> &filter);
 	void Partition();
 	bool IsPartitioned();
+	//! Whether rows are radix-partitioned without being pre-aggregated
+	bool IsPassThrough();
 
 	HashTableList GetPartition(idx_t partition);
 	HashTableList GetUnpartitioned();
@@ -49,6 +56,11 @@ private:
 	vector<BoundAggregateExpression *> bindings;
 
 	bool is_partitioned;
+	//! Whether pre-aggregation was abandoned because (almost) every row is a new group
+	bool is_pass_through;
+	//! The number of rows and the number of new groups since the last pass-through check
+	idx_t sampled_rows;
+	idx_t sampled_groups;
 	RadixPartitionInfo &partition_info;
 	vector<SelectionVector> sel_vectors;
 	unsafe_vector<idx_t> sel_vector_sizes;
@@ -58,12 +70,13 @@ private:
 
 	HashTableList unpartitioned_hts;
 	vector<HashTableList> radix_partitioned_hts;
-	idx_t tuple_size;
 
 private:
 	idx_t ListAddChunk(HashTableList &list, DataChunk &groups, Vector &group_hashes, DataChunk &payload,
 	                   const unsafe_vector<idx_t> &filter);
-	//! Returns the HT entry size used for intermediate hash tables
-	HtEntryType GetHTEntrySize();
+	idx_t PassThroughAddChunk(HashTableList &list, DataChunk &groups, Vector &group_hashes, DataChunk &payload,
+	                          const unsafe_vector<idx_t> &filter);
+	//! Checks the reduction of the local pre-aggregation so far, and switches to pass-through if it does not pay off
+	void UpdatePassThrough(idx_t row_count, idx_t new_group_count);
 };
 } // namespace duckdb
@@ -13,9 +13,42 @@
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
 #include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/execution/merge_sort_tree.hpp"
+#include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
 
+//! The thread-local scratch space used to compute the frames of a window aggregate.
+//! The aggregates themselves are read-only after Finalize, so each thread evaluating a partition has its own.
+class WindowAggregateLocalState {
+public:
+	explicit WindowAggregateLocalState(const AggregateObject &aggr);
+	~WindowAggregateLocalState();
+
+	void AggregateInit();
+	void AggegateFinal(Vector &result, idx_t rid);
+
+	//! The aggregate that the window function is computed over
+	const AggregateObject &aggr;
+	//! Data pointer that contains a single state, used for intermediate window segment aggregation
+	vector<data_t> state;
+	//! Reused result state container for the window functions
+	Vector statev;
+	//! A vector of pointers to "state", used for intermediate window segment aggregation
+	Vector statep;
+	//! Input data chunk, used for intermediate window segment aggregation
+	DataChunk inputs;
+	//! The selected rows of the input
+	SelectionVector sel;
+	//! The previous frame, used for incremental evaluation by the window API
+	FrameBounds frame;
+	//! Whether the state is maintained incrementally by the window API, and so must be destroyed
+	bool window_state;
+	//! The current result partition being read
+	idx_t partition;
+};
+
 class WindowAggregateState {
 public:
 	WindowAggregateState(AggregateObject aggr, const LogicalType &result_type_p);
@@ -23,7 +56,9 @@ public:
 
 	virtual void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize();
-	virtual void Compute(Vector &result, idx_t rid, idx_t start, idx_t end);
+	virtual unique_ptr<WindowAggregateLocalState> GetLocalState() const;
+	//! Computes the frame [start, end) into result[rid]. Can be called concurrently with different local states.
+	virtual void Compute(WindowAggregateLocalState &lstate, Vector &result, idx_t rid, idx_t start, idx_t end) const;
 
 protected:
 	void AggregateInit();
@@ -54,19 +89,59 @@ public:
 
 	void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) override;
 	void Finalize() override;
-	void Compute(Vector &result, idx_t rid, idx_t start, idx_t end) override;
+	void Compute(WindowAggregateLocalState &lstate, Vector &result, idx_t rid, idx_t start, idx_t end) const override;
 
 private:
 	//! Partition starts
 	vector<idx_t> partition_offsets;
 	//! Aggregate results
 	unique_ptr<Vector> results;
-	//! The current result partition being built/read
+	//! The current result partition being built
 	idx_t partition;
-	//! The current input row being built/read
+	//! The current input row being built
 	idx_t row;
 };
 
+class WindowDistinctAggregate : public WindowAggregateState {
+public:
+	WindowDistinctAggregate(AggregateObject aggr, const LogicalType &result_type, ClientContext &context,
+	                        DataChunk *input, const ValidityMask &filter_mask, WindowAggregationMode mode);
+	~WindowDistinctAggregate() override;
+
+	void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) override;
+	void Finalize() override;
+	void Compute(WindowAggregateLocalState &lstate, Vector &result, idx_t rid, idx_t start, idx_t end) const override;
+
+private:
+	//! Whether the aggregate is a COUNT that can be answered from the merge sort tree alone
+	bool IsCount() const;
+	//! Aggregates the selected rows of the frame into the local state
+	void UpdateFrame(WindowAggregateLocalState &lstate, idx_t count) const;
+
+	//! The (sorted) input chunk collection on which the aggregate is computed
+	DataChunk *input_ref;
+	//! The filtered rows in input_ref
+	const ValidityMask &filter_mask;
+	//! The window aggregation mode
+	WindowAggregationMode mode;
+
+	//! Hash table used to find the previous occurrence of each value while sinking
+	unique_ptr<GroupedAggregateHashTable> ht;
+	AggregateHTAppendState append_state;
+	Vector addresses;
+	//! The row index of the last occurrence of each distinct value
+	unordered_map<data_ptr_t, idx_t> last_idcs;
+	//! The current input row being sunk
+	idx_t row;
+
+	//! For each row, one more than the index of the previous row with the same value (zero if there is none),
+	//! or the maximum index if the row must never be aggregated. So a row is the first occurrence of its value
+	//! in the frame [start, end) iff its previous index is <= start.
+	vector<idx_t> prev_idcs;
+	//! A merge sort tree over prev_idcs, used to count the distinct values of a frame
+	unique_ptr<MergeSortTree<idx_t>> prev_tree;
+};
+
 class WindowSegmentTree {
 public:
 	using FrameBounds = std::pair<idx_t, idx_t>;
@@ -75,23 +150,31 @@ public:
 	                  const ValidityMask &filter_mask, WindowAggregationMode mode);
 	~WindowSegmentTree();
 
-	//! First row contains the result.
-	void Compute(Vector &result, idx_t rid, idx_t start, idx_t end);
+	unique_ptr<WindowAggregateLocalState> GetLocalState() const;
+
+	//! Computes the frame [begin, end) into result[rid]. Can be called concurrently with different local states.
+	void Compute(WindowAggregateLocalState &lstate, Vector &result, idx_t rid, idx_t begin, idx_t end) const;
 
 private:
 	void ConstructTree();
-	void ExtractFrame(idx_t begin, idx_t end);
-	void WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end);
-	void AggregateInit();
-	void AggegateFinal(Vector &result, idx_t rid);
+	void ExtractFrame(WindowAggregateLocalState &lstate, idx_t begin, idx_t end) const;
+	void WindowSegmentValue(WindowAggregateLocalState &lstate, idx_t l_idx, idx_t begin, idx_t end) const;
 
 	//! Use the window API, if available
 	inline bool UseWindowAPI() const {
-		return mode < WindowAggregationMode::COMBINE;
+		return mode == WindowAggregationMode::WINDOW || mode == WindowAggregationMode::INCREMENTAL;
+	}
+	//! Use the window index (e.g., a merge sort tree), if available
+	inline bool UseWindowIndex() const {
+		return mode == WindowAggregationMode::WINDOW;
 	}
 	//! Use the combine API, if available
 	inline bool UseCombineAPI() const {
-		return mode < WindowAggregationMode::SEPARATE;
+		return mode != WindowAggregationMode::SEPARATE;
+	}
+	//! Whether all threads can share the read-only window index state
+	inline bool UseSharedState() const {
+		return aggr.function.window && UseWindowAPI() && aggr.function.window_init && UseWindowIndex();
 	}
 
 	//! The aggregate that the window function is computed over
@@ -99,17 +182,9 @@ private:
 	//! The result type of the window function
 	LogicalType result_type;
 
-	//! Data pointer that contains a single state, used for intermediate window segment aggregation
+	//! The state containing the window index, which is shared (read-only) by all threads
 	vector<data_t> state;
-	//! Input data chunk, used for intermediate window segment aggregation
-	DataChunk inputs;
-	//! The filtered rows in inputs.
-	SelectionVector filter_sel;
-	//! A vector of pointers to "state", used for intermediate window segment aggregation
-	Vector statep;
-	//! The frame boundaries, used for the window functions
-	FrameBounds frame;
-	//! Reused result state container for the window functions
+	//! Reused result state container for destroying the window index
 	Vector statev;
 
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
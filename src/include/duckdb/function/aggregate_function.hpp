@@ -46,6 +46,10 @@ typedef void (*aggregate_window_t)(Vector inputs[], const ValidityMask &filter_m
                                    AggregateInputData &aggr_input_data, idx_t input_count, data_ptr_t state,
                                    const FrameBounds &frame, const FrameBounds &prev, Vector &result, idx_t rid,
                                    idx_t bias);
+//! The type used for building an index over all the input rows of a windowed aggregate (optional)
+typedef void (*aggregate_window_init_t)(Vector inputs[], const ValidityMask &filter_mask,
+                                        AggregateInputData &aggr_input_data, idx_t input_count, data_ptr_t state,
+                                        idx_t count);
 
 typedef void (*aggregate_serialize_t)(FieldWriter &writer, const FunctionData *bind_data,
                                       const AggregateFunction &function);
@@ -65,8 +69,9 @@ public:
 	    : BaseScalarFunction(name, arguments, return_type, FunctionSideEffects::NO_SIDE_EFFECTS,
 	                         LogicalType(LogicalTypeId::INVALID), null_handling),
 	      state_size(state_size), initialize(initialize), update(update), combine(combine), finalize(finalize),
-	      simple_update(simple_update), window(window), bind(bind), destructor(destructor), statistics(statistics),
-	      serialize(serialize), deserialize(deserialize), order_dependent(AggregateOrderDependent::ORDER_DEPENDENT) {
+	      simple_update(simple_update), window(window), window_init(nullptr), bind(bind), destructor(destructor),
+	      statistics(statistics), serialize(serialize), deserialize(deserialize),
+	      order_dependent(AggregateOrderDependent::ORDER_DEPENDENT) {
 	}
 
 	AggregateFunction(const string &name, const vector<LogicalType> &arguments, const LogicalType &return_type,
@@ -79,8 +84,9 @@ public:
 	    : BaseScalarFunction(name, arguments, return_type, FunctionSideEffects::NO_SIDE_EFFECTS,
 	                         LogicalType(LogicalTypeId::INVALID)),
 	      state_size(state_size), initialize(initialize), update(update), combine(combine), finalize(finalize),
-	      simple_update(simple_update), window(window), bind(bind), destructor(destructor), statistics(statistics),
-	      serialize(serialize), deserialize(deserialize), order_dependent(AggregateOrderDependent::ORDER_DEPENDENT) {
+	      simple_update(simple_update), window(window), window_init(nullptr), bind(bind), destructor(destructor),
+	      statistics(statistics), serialize(serialize), deserialize(deserialize),
+	      order_dependent(AggregateOrderDependent::ORDER_DEPENDENT) {
 	}
 
 	AggregateFunction(const vector<LogicalType> &arguments, const LogicalType &return_type, aggregate_size_t state_size,
@@ -120,6 +126,8 @@ public:
 	aggregate_simple_update_t simple_update;
 	//! The windowed aggregate frame update function (may be null)
 	aggregate_window_t window;
+	//! The windowed aggregate index construction function (may be null)
+	aggregate_window_init_t window_init;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
@@ -136,7 +144,8 @@ public:
 
 	bool operator==(const AggregateFunction &rhs) const {
 		return state_size == rhs.state_size && initialize == rhs.initialize && update == rhs.update &&
-		       combine == rhs.combine && finalize == rhs.finalize && window == rhs.window;
+		       combine == rhs.combine && finalize == rhs.finalize && window == rhs.window &&
+		       window_init == rhs.window_init;
 	}
 	bool operator!=(const AggregateFunction &rhs) const {
 		return !(*this == rhs);
@@ -228,6 +237,14 @@ public:
 		                                                                   state, frame, prev, result, rid, bias);
 	}
 
+	template <class STATE, class INPUT_TYPE, class OP>
+	static void UnaryWindowInit(Vector inputs[], const ValidityMask &filter_mask, AggregateInputData &aggr_input_data,
+	                            idx_t input_count, data_ptr_t state, idx_t count) {
+		D_ASSERT(input_count == 1);
+		AggregateExecutor::UnaryWindowInit<STATE, INPUT_TYPE, OP>(inputs[0], filter_mask, aggr_input_data, state,
+		                                                          count);
+	}
+
 	template <class STATE, class A_TYPE, class B_TYPE, class OP>
 	static void BinaryScatterUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
 	                                Vector &states, idx_t count) {
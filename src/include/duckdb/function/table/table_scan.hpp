@@ -14,10 +14,13 @@
 
 namespace duckdb {
 class DuckTableEntry;
+class LogicalGet;
 class TableCatalogEntry;
 
 struct TableScanBindData : public TableFunctionData {
-	explicit TableScanBindData(DuckTableEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
+	explicit TableScanBindData(DuckTableEntry &table)
+	    : table(table), is_index_scan(false), is_create_index(false), is_index_order_scan(false),
+	      order_column(DConstants::INVALID_INDEX), order_limit(0) {
 	}
 
 	//! The table to scan
@@ -29,11 +32,19 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_create_index;
 	//! The row ids to fetch (in case of an index scan)
 	vector<row_t> result_ids;
+	//! Whether or not the table scan produces the rows in the key order of an index
+	bool is_index_order_scan;
+	//! The indexed column that determines the order (in case of an index order scan)
+	column_t order_column;
+	//! The amount of rows after which the index order scan can stop (in case of an index order scan)
+	idx_t order_limit;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = (const TableScanBindData &)other_p;
-		return &other.table == &table && result_ids == other.result_ids;
+		return &other.table == &table && result_ids == other.result_ids &&
+		       is_index_order_scan == other.is_index_order_scan && order_column == other.order_column &&
+		       order_limit == other.order_limit;
 	}
 };
 
@@ -42,6 +53,10 @@ struct TableScanFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
+	static TableFunction GetIndexOrderScanFunction();
+	//! Try to turn the table scan into a scan that produces (at least) the first limit rows in the order of the given
+	//! column using an index on that column. Returns true if successful
+	static bool PushdownIndexOrder(LogicalGet &get, column_t column_id, idx_t limit);
 	static optional_ptr<TableCatalogEntry> GetTableEntry(const TableFunction &function,
 	                                                     const optional_ptr<FunctionData> bind_data);
 };
@@ -104,6 +104,11 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress blocks that are written to the temporary directory
+	bool temp_file_compression = false;
+	//! The maximum memory used to keep evicted temporary blocks compressed in memory before writing them to the
+	//! temporary directory. Default: 0 (evicted blocks are written to the temporary directory right away)
+	idx_t compressed_memory_limit = 0;
 	//! The collation type of the database
 	string collation = string();
 	//! The order type used when none is specified (default: ASC)
@@ -120,6 +125,8 @@ struct DBConfigOptions {
 	bool force_checkpoint = false;
 	//! Run a checkpoint on successful shutdown and delete the WAL, to leave only a single database file behind
 	bool checkpoint_on_shutdown = true;
+	//! Whether or not to compress and write the row groups of a table in parallel during a checkpoint
+	bool parallel_checkpoint = false;
 	//! Debug flag that decides when a checkpoing should be aborted. Only used for testing purposes.
 	CheckpointAbort checkpoint_abort = CheckpointAbort::NO_ABORT;
 	//! Initialize the database with the standard set of DuckDB functions
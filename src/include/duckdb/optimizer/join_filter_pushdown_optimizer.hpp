@@ -0,0 +1,32 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_filter_pushdown_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/column_binding.hpp"
+
+namespace duckdb {
+class LogicalComparisonJoin;
+struct JoinFilterPushdownColumn;
+
+//! The JoinFilterPushdownOptimizer links equality joins to the table scans on their probe side, so that the hash join
+//! can push the min/max of its build-side keys into the scan as a filter once the build side has been finalized
+class JoinFilterPushdownOptimizer : public LogicalOperatorVisitor {
+public:
+	void VisitOperator(LogicalOperator &op) override;
+
+	//! Whether or not a join key of the given type can be pushed into a table scan
+	static bool SupportsType(const LogicalType &type);
+
+private:
+	void GenerateJoinFilters(LogicalComparisonJoin &join);
+	//! Find the table scan that produces the given column binding, if there is one that can be filtered
+	static bool FindProbeColumn(LogicalOperator &op, ColumnBinding binding, JoinFilterPushdownColumn &result);
+};
+} // namespace duckdb
@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/task_executor.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/preserved_error.hpp"
+#include "duckdb/parallel/task.hpp"
+
+namespace duckdb {
+class BaseExecutorTask;
+class TaskScheduler;
+struct ProducerToken;
+
+//! The TaskExecutor runs a set of tasks on the TaskScheduler outside of query execution (e.g. during a checkpoint)
+//! The thread that schedules the tasks participates in executing them in WorkOnTasks
+class TaskExecutor {
+public:
+	explicit TaskExecutor(TaskScheduler &scheduler);
+	explicit TaskExecutor(DatabaseInstance &db);
+	~TaskExecutor();
+
+	//! Push an error into the TaskExecutor - remaining tasks are skipped
+	void PushError(PreservedError error);
+	//! Whether or not any task has thrown an error
+	bool HasError();
+	//! Throw the error that was pushed using PushError
+	void ThrowError();
+
+	//! Schedule a new task
+	void ScheduleTask(unique_ptr<BaseExecutorTask> task);
+	//! Label a task as finished
+	void FinishTask();
+	//! Work on tasks until all scheduled tasks are finished. Throws an exception if any task failed.
+	void WorkOnTasks();
+
+private:
+	TaskScheduler &scheduler;
+	unique_ptr<ProducerToken> token;
+	atomic<idx_t> completed_tasks;
+	atomic<idx_t> total_tasks;
+	mutex error_lock;
+	vector<PreservedError> errors;
+	atomic<bool> has_error;
+};
+
+//! A task that is executed by the TaskExecutor
+class BaseExecutorTask : public Task {
+public:
+	explicit BaseExecutorTask(TaskExecutor &executor);
+
+	virtual void ExecuteTask() = 0;
+	TaskExecutionResult Execute(TaskExecutionMode mode) override;
+
+protected:
+	TaskExecutor &executor;
+};
+
+} // namespace duckdb
@@ -52,6 +52,8 @@ public:
 	unique_ptr<ParsedExpression> filter_expr;
 	//! True to ignore NULL values
 	bool ignore_nulls;
+	//! True to aggregate only the distinct values in each frame
+	bool distinct;
 	//! The window boundaries
 	WindowBoundary start = WindowBoundary::INVALID;
 	WindowBoundary end = WindowBoundary::INVALID;
@@ -87,6 +89,9 @@ public:
 		// Start with function call
 		string result = schema.empty() ? function_name : schema + "." + function_name;
 		result += "(";
+		if (entry.distinct) {
+			result += "DISTINCT ";
+		}
 		if (entry.children.size()) {
 			result += StringUtil::Join(entry.children, entry.children.size(), ", ",
 			                           [](const unique_ptr<BASE> &child) { return child->ToString(); });
@@ -0,0 +1,59 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/validity_mask.hpp"
+
+namespace duckdb {
+class Vector;
+
+//! BloomFilter is a blocked Bloom filter over the hashes of a set of keys (e.g. the build-side keys of a hash join)
+//! Every key sets BITS_PER_KEY bits within a single 64-bit word, so checking a key touches a single word
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! The number of bits of the filter
+	static constexpr const idx_t FILTER_BITS = 1 << 20;
+	//! The number of bits that are set for every key
+	static constexpr const idx_t BITS_PER_KEY = 3;
+	//! The maximum number of keys for which the filter is selective enough to be worth checking
+	static constexpr const idx_t MAX_KEYS = FILTER_BITS / 8;
+
+public:
+	BloomFilter();
+	BloomFilter(shared_ptr<vector<uint64_t>> words, idx_t key_count);
+
+	//! The number of keys that were inserted into the filter (including duplicates)
+	idx_t key_count;
+
+public:
+	//! Insert the non-NULL keys into the filter
+	void Insert(Vector &keys, idx_t count);
+	//! Add the keys of another filter to this filter
+	void Merge(const BloomFilter &other);
+	//! Filter the selected rows of the vector on the keys of the filter - NULL values never pass the filter
+	idx_t Select(Vector &input, SelectionVector &sel, idx_t &approved_tuple_count, ValidityMask &mask) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	void Serialize(FieldWriter &writer) const override;
+	static unique_ptr<TableFilter> Deserialize(FieldReader &source);
+
+private:
+	static uint64_t KeyMask(hash_t hash);
+
+	//! The words of the filter - these are shared between copies of the filter, and not modified once it is pushed
+	shared_ptr<vector<uint64_t>> words;
+};
+
+} // namespace duckdb
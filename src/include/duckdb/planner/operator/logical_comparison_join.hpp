@@ -15,6 +15,17 @@
 #include "duckdb/planner/operator/logical_join.hpp"
 
 namespace duckdb {
+class DynamicTableFilterSet;
+
+//! A join condition whose build-side keys can be used to filter the probe-side table scan
+struct JoinFilterPushdownColumn {
+	//! The index of the (COMPARE_EQUAL) join condition
+	idx_t join_condition;
+	//! The dynamic filters of the probe-side table scan
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The index of the probe column within the column ids of the table scan
+	idx_t scan_column_index;
+};
 
 //! LogicalComparisonJoin represents a join that involves comparisons between the LHS and RHS
 class LogicalComparisonJoin : public LogicalJoin {
@@ -29,6 +40,8 @@ public:
 	vector<JoinCondition> conditions;
 	//! Used for duplicate-eliminated joins
 	vector<LogicalType> delim_types;
+	//! The probe-side table scans that can be filtered on the build-side keys (if any)
+	vector<JoinFilterPushdownColumn> filter_pushdown;
 
 public:
 	string ParamsToString() const override;
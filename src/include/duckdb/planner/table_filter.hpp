@@ -12,9 +12,13 @@
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/enums/filter_propagate_result.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/reference_map.hpp"
 
 namespace duckdb {
 class BaseStatistics;
+class PhysicalOperator;
 class FieldWriter;
 class FieldReader;
 
@@ -23,7 +27,8 @@ enum class TableFilterType : uint8_t {
 	IS_NULL = 1,
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
-	CONJUNCTION_AND = 4
+	CONJUNCTION_AND = 4,
+	BLOOM_FILTER = 5 // membership of a set of keys (e.g. pushed by a hash join), with false positives
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -43,6 +48,7 @@ public:
 	virtual bool Equals(const TableFilter &other) const {
 		return filter_type != other.filter_type;
 	}
+	virtual unique_ptr<TableFilter> Copy() const = 0;
 
 	void Serialize(Serializer &serializer) const;
 	virtual void Serialize(FieldWriter &writer) const = 0;
@@ -102,4 +108,22 @@ public:
 	static unique_ptr<TableFilterSet> Deserialize(Deserializer &source);
 };
 
+//! DynamicTableFilterSet holds filters that are pushed into a table scan during execution (e.g. by a hash join)
+//! The filters are kept per pushing operator, which clears its filters at the start of every execution of the plan
+class DynamicTableFilterSet {
+public:
+	//! Remove the filters pushed by the given operator
+	void ClearFilters(const PhysicalOperator &op);
+	//! Push a filter on the (relative) column index of the scan
+	void PushFilter(const PhysicalOperator &op, idx_t column_index, unique_ptr<TableFilter> filter);
+	//! Whether or not any filters have been pushed so far
+	bool HasFilters() const;
+	//! Returns the set of filters to scan with: a copy of the existing filters combined with the dynamic filters
+	unique_ptr<TableFilterSet> GetFinalTableFilters(optional_ptr<TableFilterSet> existing_filters) const;
+
+private:
+	mutable mutex lock;
+	reference_map_t<const PhysicalOperator, unique_ptr<TableFilterSet>> filters;
+};
+
 } // namespace duckdb
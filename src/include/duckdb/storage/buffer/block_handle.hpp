@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/allocator.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -98,11 +99,18 @@ public:
 		return memory_usage;
 	}
 
+	//! Whether the block is unloaded, but its data is kept compressed in memory
+	inline bool IsCompressed() const {
+		return compressed_data.get() != nullptr;
+	}
+
 private:
 	static BufferHandle Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileBuffer> buffer = nullptr);
 	unique_ptr<FileBuffer> UnloadAndTakeBlock();
 	void Unload();
 	bool CanUnload();
+	//! Release the compressed data of the block that is kept in memory
+	void FreeCompressedData();
 
 	//! The block-level lock
 	mutex lock;
@@ -114,6 +122,8 @@ private:
 	const block_id_t block_id;
 	//! Pointer to loaded data (if any)
 	unique_ptr<FileBuffer> buffer;
+	//! The compressed data of an unloaded temporary block that is kept in memory (if any)
+	AllocatedData compressed_data;
 	//! Internal eviction timestamp
 	atomic<idx_t> eviction_timestamp;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
@@ -7,6 +7,11 @@ namespace duckdb {
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The size of each block stored in the file (smaller than Storage::BLOCK_ALLOC_SIZE for compressed blocks, or the
+	//! size of the buffer for files that hold a single buffer larger than a block)
+	idx_t block_size;
+	//! The number of blocks currently stored in the file
+	idx_t block_count;
 };
 
 } // namespace duckdb
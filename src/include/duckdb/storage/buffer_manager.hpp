@@ -74,8 +74,15 @@ protected:
 	virtual void PurgeQueue() = 0;
 	virtual void AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 	virtual void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
+	virtual void WriteTemporaryBuffer(block_id_t block_id, AllocatedData &compressed_data);
 	virtual unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> buffer);
 	virtual void DeleteTemporaryFile(block_id_t id);
+	//! Compress an evicted temporary buffer so that it can be kept in memory. Returns empty data if the buffer should
+	//! be written to disk instead.
+	virtual AllocatedData CompressTemporaryBuffer(FileBuffer &buffer);
+	virtual unique_ptr<FileBuffer> DecompressTemporaryBuffer(block_id_t id, AllocatedData &compressed_data,
+	                                                         unique_ptr<FileBuffer> buffer);
+	virtual void FreeCompressedTemporaryBuffer(AllocatedData &compressed_data);
 };
 
 } // namespace duckdb
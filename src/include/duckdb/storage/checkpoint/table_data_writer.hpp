@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/storage/checkpoint/row_group_writer.hpp"
+#include "duckdb/storage/checkpoint_timings.hpp"
 
 namespace duckdb {
 class DuckTableEntry;
@@ -35,6 +36,8 @@ public:
 	virtual unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) = 0;
 
 	virtual void AddRowGroup(RowGroupPointer &&row_group_pointer, unique_ptr<RowGroupWriter> &&writer);
+	//! The timings of the checkpoint this table is written as part of
+	virtual CheckpointTimings &GetCheckpointTimings() = 0;
 
 protected:
 	DuckTableEntry &table;
@@ -50,6 +53,7 @@ public:
 public:
 	virtual void FinalizeTable(TableStatistics &&global_stats, DataTableInfo *info) override;
 	virtual unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) override;
+	virtual CheckpointTimings &GetCheckpointTimings() override;
 
 private:
 	SingleFileCheckpointWriter &checkpoint_manager;
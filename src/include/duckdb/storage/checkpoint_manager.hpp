@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/storage/partial_block_manager.hpp"
+#include "duckdb/storage/checkpoint_timings.hpp"
 #include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
 
@@ -102,6 +103,10 @@ public:
 	virtual unique_ptr<TableDataWriter> GetTableDataWriter(TableCatalogEntry &table) override;
 
 	BlockManager &GetBlockManager();
+	//! The time spent in the different phases of the checkpoint
+	const CheckpointTimings &GetCheckpointTimings() const {
+		return timings;
+	}
 
 private:
 	//! The metadata writer is responsible for writing schema information
@@ -111,6 +116,8 @@ private:
 	//! Because this is single-file storage, we can share partial blocks across
 	//! an entire checkpoint.
 	PartialBlockManager partial_block_manager;
+	//! The time spent in the different phases of the checkpoint
+	CheckpointTimings timings;
 };
 
 } // namespace duckdb
@@ -0,0 +1,33 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/checkpoint_timings.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The time (in seconds) spent in the different phases of a checkpoint
+struct CheckpointTimings {
+	//! Total time spent in the checkpoint
+	double total = 0;
+	//! Time spent compressing the row groups and writing their data blocks
+	double write_row_group_data = 0;
+	//! Time spent writing the data pointers, statistics and indexes of the tables
+	double write_table_metadata = 0;
+	//! Time spent flushing the remaining partially filled blocks
+	double flush_partial_blocks = 0;
+	//! Time spent flushing the metadata, writing the header and truncating the WAL
+	double write_header = 0;
+	//! The number of row groups that were written
+	idx_t row_group_count = 0;
+	//! Whether or not the row groups were written in parallel
+	bool parallel = false;
+};
+
+} // namespace duckdb
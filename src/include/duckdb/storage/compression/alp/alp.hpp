@@ -0,0 +1,230 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/storage/compression/alp/alp_constants.hpp"
+#include "duckdb/storage/compression/patas/patas.hpp"
+
+namespace duckdb {
+
+//! ALP ("Adaptive Lossless floating-Point") stores a vector of floating point values as integers:
+//! every value v is encoded as round(v * 10^exponent * 10^-factor). The integers are stored with a frame of
+//! reference and bitpacked, values that do not round-trip exactly are stored verbatim as exceptions.
+struct AlpCombination {
+	AlpCombination() : exponent(0), factor(0) {
+	}
+	AlpCombination(uint8_t exponent, uint8_t factor) : exponent(exponent), factor(factor) {
+	}
+	uint8_t exponent;
+	uint8_t factor;
+};
+
+//! Scratch space holding the encoded representation of a single vector
+template <class T>
+struct AlpEncodedVector {
+	using SIGNED = typename AlpTypedConstants<T>::SIGNED;
+	using UNSIGNED = typename AlpTypedConstants<T>::UNSIGNED;
+
+	AlpCombination combination;
+	uint16_t exception_count = 0;
+	bitpacking_width_t bit_width = 0;
+	SIGNED frame_of_reference = 0;
+	SIGNED encoded_values[AlpConstants::ALP_VECTOR_SIZE];
+	UNSIGNED for_values[AlpConstants::ALP_VECTOR_SIZE];
+	T exceptions[AlpConstants::ALP_VECTOR_SIZE];
+	uint16_t exception_positions[AlpConstants::ALP_VECTOR_SIZE];
+
+	//! The number of bytes this vector occupies in a segment
+	idx_t SerializedSize(idx_t count) const {
+		return AlpConstants::VECTOR_HEADER_SIZE + BitpackingPrimitives::GetRequiredSize(count, bit_width) +
+		       exception_count * (sizeof(T) + AlpConstants::EXCEPTION_POSITION_SIZE);
+	}
+
+	void Serialize(data_ptr_t dest, idx_t count) {
+		Store<uint8_t>(combination.exponent, dest);
+		Store<uint8_t>(combination.factor, dest + 1);
+		Store<uint8_t>(bit_width, dest + 2);
+		Store<uint8_t>(0, dest + 3);
+		Store<uint16_t>(exception_count, dest + 4);
+		Store<uint16_t>(0, dest + 6);
+		Store<int64_t>(frame_of_reference, dest + 8);
+		dest += AlpConstants::VECTOR_HEADER_SIZE;
+
+		if (bit_width > 0) {
+			BitpackingPrimitives::PackBuffer<UNSIGNED>(dest, for_values, count, bit_width);
+		}
+		dest += BitpackingPrimitives::GetRequiredSize(count, bit_width);
+		memcpy(dest, exceptions, sizeof(T) * exception_count);
+		dest += sizeof(T) * exception_count;
+		memcpy(dest, exception_positions, AlpConstants::EXCEPTION_POSITION_SIZE * exception_count);
+	}
+};
+
+template <class T>
+struct AlpPrimitives {
+	using SIGNED = typename AlpTypedConstants<T>::SIGNED;
+	using UNSIGNED = typename AlpTypedConstants<T>::UNSIGNED;
+	using EXACT_TYPE = typename FloatingToExact<T>::type;
+	using CONSTANTS = AlpTypedConstants<T>;
+
+	static inline SIGNED EncodeValue(T value, AlpCombination combination) {
+		T scaled = value * CONSTANTS::EXP_ARR[combination.exponent] * CONSTANTS::FRAC_ARR[combination.factor];
+		// NaN, infinity and values that are too large to be rounded exactly become exceptions
+		bool in_range = scaled >= -CONSTANTS::ENCODING_LIMIT && scaled <= CONSTANTS::ENCODING_LIMIT;
+		scaled = in_range ? scaled : T(0);
+		return SIGNED(scaled + CONSTANTS::MAGIC_NUMBER - CONSTANTS::MAGIC_NUMBER);
+	}
+
+	static inline T DecodeValue(SIGNED encoded, AlpCombination combination) {
+		return T(encoded) * CONSTANTS::EXP_ARR[combination.factor] * CONSTANTS::FRAC_ARR[combination.exponent];
+	}
+
+	//! Whether the value survives the round-trip bit-for-bit (this also distinguishes -0.0 from 0.0)
+	static inline bool IsExact(T value, SIGNED encoded, AlpCombination combination) {
+		T decoded = DecodeValue(encoded, combination);
+		return Load<EXACT_TYPE>(const_data_ptr_cast(&decoded)) == Load<EXACT_TYPE>(const_data_ptr_cast(&value));
+	}
+
+	//! Estimate the size in bits of a vector encoded with the given combination, using only a sample of the values
+	static idx_t EstimateSize(const T *values, idx_t count, AlpCombination combination) {
+		idx_t sample_step = MaxValue<idx_t>(count / AlpConstants::SAMPLES_PER_VECTOR, 1);
+		idx_t sample_count = 0;
+		idx_t exception_count = 0;
+		SIGNED min_value = NumericLimits<SIGNED>::Maximum();
+		SIGNED max_value = NumericLimits<SIGNED>::Minimum();
+		for (idx_t i = 0; i < count; i += sample_step) {
+			auto encoded = EncodeValue(values[i], combination);
+			sample_count++;
+			if (!IsExact(values[i], encoded, combination)) {
+				exception_count++;
+				continue;
+			}
+			min_value = MinValue(min_value, encoded);
+			max_value = MaxValue(max_value, encoded);
+		}
+		idx_t bit_width = 0;
+		if (exception_count < sample_count) {
+			bit_width = BitpackingPrimitives::MinimumBitWidth<UNSIGNED>(UNSIGNED(max_value) - UNSIGNED(min_value));
+		}
+		return sample_count * bit_width +
+		       exception_count * (sizeof(T) + AlpConstants::EXCEPTION_POSITION_SIZE) * 8;
+	}
+
+	//! Find the best combination for a vector, either among all possible combinations or among a given set
+	static AlpCombination FindBestCombination(const T *values, idx_t count,
+	                                          const vector<AlpCombination> &candidates) {
+		AlpCombination best;
+		idx_t best_size = NumericLimits<idx_t>::Maximum();
+		if (candidates.empty()) {
+			for (uint8_t exponent = 0; exponent <= CONSTANTS::MAX_EXPONENT; exponent++) {
+				for (uint8_t factor = 0; factor <= exponent; factor++) {
+					AlpCombination combination(exponent, factor);
+					auto size = EstimateSize(values, count, combination);
+					if (size < best_size) {
+						best_size = size;
+						best = combination;
+					}
+				}
+			}
+			return best;
+		}
+		if (candidates.size() == 1) {
+			return candidates[0];
+		}
+		for (auto &combination : candidates) {
+			auto size = EstimateSize(values, count, combination);
+			if (size < best_size) {
+				best_size = size;
+				best = combination;
+			}
+		}
+		return best;
+	}
+
+	static void EncodeVector(const T *values, idx_t count, AlpCombination combination, AlpEncodedVector<T> &result) {
+		D_ASSERT(count > 0 && count <= AlpConstants::ALP_VECTOR_SIZE);
+		result.combination = combination;
+
+		// encode all values, collecting the positions of the exceptions without branching
+		idx_t exception_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			auto encoded = EncodeValue(values[i], combination);
+			result.encoded_values[i] = encoded;
+			result.exception_positions[exception_count] = uint16_t(i);
+			exception_count += !IsExact(values[i], encoded, combination);
+		}
+
+		// replace the exceptions by a value that is already present, so they do not widen the bitpacking
+		SIGNED fill_value = 0;
+		for (idx_t i = 0, exception_idx = 0; i < count; i++) {
+			if (exception_idx < exception_count && result.exception_positions[exception_idx] == i) {
+				exception_idx++;
+				continue;
+			}
+			fill_value = result.encoded_values[i];
+			break;
+		}
+		for (idx_t i = 0; i < exception_count; i++) {
+			auto position = result.exception_positions[i];
+			result.exceptions[i] = values[position];
+			result.encoded_values[position] = fill_value;
+		}
+		result.exception_count = uint16_t(exception_count);
+
+		// frame of reference + bitpacking
+		SIGNED min_value = result.encoded_values[0];
+		SIGNED max_value = result.encoded_values[0];
+		for (idx_t i = 1; i < count; i++) {
+			min_value = MinValue(min_value, result.encoded_values[i]);
+			max_value = MaxValue(max_value, result.encoded_values[i]);
+		}
+		for (idx_t i = 0; i < count; i++) {
+			result.for_values[i] = UNSIGNED(result.encoded_values[i]) - UNSIGNED(min_value);
+		}
+		result.frame_of_reference = min_value;
+		result.bit_width = BitpackingPrimitives::MinimumBitWidth<UNSIGNED>(UNSIGNED(max_value) - UNSIGNED(min_value));
+	}
+
+	//! Decode a serialized vector into 'result'
+	static void DecodeVector(const_data_ptr_t source, idx_t count, T *result, UNSIGNED *unpack_buffer) {
+		AlpCombination combination(Load<uint8_t>(source), Load<uint8_t>(source + 1));
+		auto bit_width = Load<uint8_t>(source + 2);
+		auto exception_count = Load<uint16_t>(source + 4);
+		auto frame_of_reference = UNSIGNED(Load<int64_t>(source + 8));
+		source += AlpConstants::VECTOR_HEADER_SIZE;
+
+		if (bit_width > 0) {
+			BitpackingPrimitives::UnPackBuffer<UNSIGNED>(data_ptr_cast(unpack_buffer), (data_ptr_t)source, count,
+			                                             bit_width, true);
+		} else {
+			memset(unpack_buffer, 0, sizeof(UNSIGNED) * count);
+		}
+		source += BitpackingPrimitives::GetRequiredSize(count, bit_width);
+
+		// the hot loop: no branches, so the compiler can vectorize it
+		const T factor_multiplier = CONSTANTS::EXP_ARR[combination.factor];
+		const T exponent_fraction = CONSTANTS::FRAC_ARR[combination.exponent];
+		for (idx_t i = 0; i < count; i++) {
+			result[i] = T(SIGNED(unpack_buffer[i] + frame_of_reference)) * factor_multiplier * exponent_fraction;
+		}
+
+		// patch the exceptions
+		auto exceptions = source;
+		auto positions = source + sizeof(T) * exception_count;
+		for (idx_t i = 0; i < exception_count; i++) {
+			auto position = Load<uint16_t>(positions + i * AlpConstants::EXCEPTION_POSITION_SIZE);
+			D_ASSERT(position < count);
+			result[position] = Load<T>(exceptions + i * sizeof(T));
+		}
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,125 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp_analyze.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/alp/alp.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/storage_info.hpp"
+
+namespace duckdb {
+
+template <class T>
+struct AlpAnalyzeState : public AnalyzeState {
+public:
+	using CONSTANTS = AlpTypedConstants<T>;
+	static constexpr const idx_t COMBINATION_COUNT = (CONSTANTS::MAX_EXPONENT + 1) * (CONSTANTS::MAX_EXPONENT + 1);
+
+	AlpAnalyzeState() : encoded(make_uniq<AlpEncodedVector<T>>()) {
+		memset(combination_counts, 0, sizeof(combination_counts));
+	}
+
+	//! The valid values of the vector that is currently being analyzed
+	T input_vector[AlpConstants::ALP_VECTOR_SIZE];
+	idx_t valid_count = 0;
+	idx_t vector_count = 0;
+	unique_ptr<AlpEncodedVector<T>> encoded;
+
+	idx_t data_byte_size = 0;
+	idx_t metadata_byte_size = 0;
+	idx_t total_vector_count = 0;
+	//! How often every (exponent, factor) combination was the best one for a vector
+	idx_t combination_counts[COMBINATION_COUNT];
+	//! The combinations that are tried during compression, determined in the final analyze step
+	vector<AlpCombination> best_combinations;
+
+public:
+	void AddValue(T value, bool is_valid) {
+		if (is_valid) {
+			input_vector[valid_count++] = value;
+		}
+		vector_count++;
+		if (vector_count == AlpConstants::ALP_VECTOR_SIZE) {
+			FlushVector();
+		}
+	}
+
+	void FlushVector() {
+		if (vector_count == 0) {
+			return;
+		}
+		idx_t vector_size;
+		if (valid_count == 0) {
+			vector_size = AlpConstants::VECTOR_HEADER_SIZE;
+		} else {
+			auto combination = AlpPrimitives<T>::FindBestCombination(input_vector, valid_count, {});
+			combination_counts[combination.exponent * (CONSTANTS::MAX_EXPONENT + 1) + combination.factor]++;
+			AlpPrimitives<T>::EncodeVector(input_vector, valid_count, combination, *encoded);
+			// NULLs are stored as one of the valid values, they take up space but do not widen the bitpacking
+			vector_size = encoded->SerializedSize(vector_count);
+		}
+		data_byte_size += AlignValue(vector_size);
+		metadata_byte_size += AlpConstants::METADATA_POINTER_SIZE;
+		total_vector_count++;
+		valid_count = 0;
+		vector_count = 0;
+	}
+
+	void DetermineBestCombinations() {
+		vector<pair<idx_t, idx_t>> ranked;
+		for (idx_t i = 0; i < COMBINATION_COUNT; i++) {
+			if (combination_counts[i] > 0) {
+				ranked.emplace_back(combination_counts[i], i);
+			}
+		}
+		std::sort(ranked.begin(), ranked.end(), [](const pair<idx_t, idx_t> &a, const pair<idx_t, idx_t> &b) {
+			return a.first > b.first || (a.first == b.first && a.second < b.second);
+		});
+		best_combinations.clear();
+		for (idx_t i = 0; i < ranked.size() && i < AlpConstants::MAX_COMBINATIONS; i++) {
+			auto index = ranked[i].second;
+			best_combinations.emplace_back(uint8_t(index / (CONSTANTS::MAX_EXPONENT + 1)),
+			                               uint8_t(index % (CONSTANTS::MAX_EXPONENT + 1)));
+		}
+	}
+};
+
+template <class T>
+unique_ptr<AnalyzeState> AlpInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_uniq<AlpAnalyzeState<T>>();
+}
+
+template <class T>
+bool AlpAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = (AlpAnalyzeState<T> &)state;
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		analyze_state.AddValue(data[idx], vdata.validity.RowIsValid(idx));
+	}
+	return true;
+}
+
+template <class T>
+idx_t AlpFinalAnalyze(AnalyzeState &state) {
+	auto &alp_state = (AlpAnalyzeState<T> &)state;
+	alp_state.FlushVector();
+	alp_state.DetermineBestCombinations();
+
+	// account for the header of every segment we will need
+	idx_t total_size = alp_state.data_byte_size + alp_state.metadata_byte_size;
+	idx_t segment_count = total_size / Storage::BLOCK_SIZE + 1;
+	return total_size + segment_count * AlpConstants::HEADER_SIZE;
+}
+
+} // namespace duckdb
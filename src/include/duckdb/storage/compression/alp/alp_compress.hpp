@@ -0,0 +1,176 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp_compress.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/alp/alp.hpp"
+#include "duckdb/storage/compression/alp/alp_analyze.hpp"
+
+#include "duckdb/common/types/null_value.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+namespace duckdb {
+
+// State
+
+template <class T>
+struct AlpCompressionState : public CompressionState {
+public:
+	explicit AlpCompressionState(ColumnDataCheckpointer &checkpointer, AlpAnalyzeState<T> *analyze_state)
+	    : checkpointer(checkpointer), function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ALP)),
+	      combinations(std::move(analyze_state->best_combinations)), encoded(make_uniq<AlpEncodedVector<T>>()) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	//! The combinations found during analyze, every vector picks the best one of these
+	vector<AlpCombination> combinations;
+	unique_ptr<AlpEncodedVector<T>> encoded;
+
+	T input_vector[AlpConstants::ALP_VECTOR_SIZE];
+	bool vector_validity[AlpConstants::ALP_VECTOR_SIZE];
+	idx_t vector_idx = 0;
+	idx_t null_count = 0;
+
+	// Ptr to next free spot in segment;
+	data_ptr_t data_ptr;
+	data_ptr_t metadata_ptr;
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto compressed_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		compressed_segment->function = function;
+		current_segment = std::move(compressed_segment);
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + AlignValue(AlpConstants::HEADER_SIZE);
+		metadata_ptr = handle.Ptr() + Storage::BLOCK_SIZE;
+	}
+
+	bool HasEnoughSpace(idx_t vector_size) const {
+		return data_ptr + AlignValue(vector_size) <= metadata_ptr - AlpConstants::METADATA_POINTER_SIZE;
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			bool is_valid = vdata.validity.RowIsValid(idx);
+			input_vector[vector_idx] = is_valid ? data[idx] : T(0);
+			vector_validity[vector_idx] = is_valid;
+			null_count += !is_valid;
+			vector_idx++;
+			if (vector_idx == AlpConstants::ALP_VECTOR_SIZE) {
+				CompressVector();
+			}
+		}
+	}
+
+	void CompressVector() {
+		if (null_count > 0) {
+			// store NULLs as the first valid value of the vector, so they do not cause exceptions
+			T fill_value = T(0);
+			for (idx_t i = 0; i < vector_idx; i++) {
+				if (vector_validity[i]) {
+					fill_value = input_vector[i];
+					break;
+				}
+			}
+			for (idx_t i = 0; i < vector_idx; i++) {
+				input_vector[i] = vector_validity[i] ? input_vector[i] : fill_value;
+			}
+		}
+		auto combination = AlpPrimitives<T>::FindBestCombination(input_vector, vector_idx, combinations);
+		AlpPrimitives<T>::EncodeVector(input_vector, vector_idx, combination, *encoded);
+
+		auto vector_size = encoded->SerializedSize(vector_idx);
+		if (!HasEnoughSpace(vector_size)) {
+			// Segment is full
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+
+		for (idx_t i = 0; i < vector_idx; i++) {
+			if (vector_validity[i]) {
+				NumericStats::Update<T>(current_segment->stats.statistics, input_vector[i]);
+			}
+		}
+
+		// Store where this vectors data starts, relative to the start of the segment
+		metadata_ptr -= AlpConstants::METADATA_POINTER_SIZE;
+		Store<uint32_t>(uint32_t(data_ptr - handle.Ptr()), metadata_ptr);
+		encoded->Serialize(data_ptr, vector_idx);
+		data_ptr += AlignValue(vector_size);
+
+		current_segment->count += vector_idx;
+		vector_idx = 0;
+		null_count = 0;
+	}
+
+	void FlushSegment() {
+		auto &checkpoint_state = checkpointer.GetCheckpointState();
+		auto dataptr = handle.Ptr();
+
+		// Compact the segment by moving the metadata next to the data.
+		idx_t metadata_offset = data_ptr - dataptr;
+		D_ASSERT(dataptr + metadata_offset <= metadata_ptr);
+		idx_t metadata_size = dataptr + Storage::BLOCK_SIZE - metadata_ptr;
+		idx_t total_segment_size = metadata_offset + metadata_size;
+		memmove(dataptr + metadata_offset, metadata_ptr, metadata_size);
+		// Store the offset to the end of the metadata
+		Store<uint32_t>(metadata_offset + metadata_size, dataptr);
+		handle.Destroy();
+		checkpoint_state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		if (vector_idx != 0) {
+			CompressVector();
+		}
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+// Compression Functions
+
+template <class T>
+unique_ptr<CompressionState> AlpInitCompression(ColumnDataCheckpointer &checkpointer, unique_ptr<AnalyzeState> state) {
+	return make_uniq<AlpCompressionState<T>>(checkpointer, (AlpAnalyzeState<T> *)state.get());
+}
+
+template <class T>
+void AlpCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = (AlpCompressionState<T> &)state_p;
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void AlpFinalizeCompress(CompressionState &state_p) {
+	auto &state = (AlpCompressionState<T> &)state_p;
+	state.Finalize();
+}
+
+} // namespace duckdb
@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp_constants.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+class AlpConstants {
+public:
+	//! Number of values that are encoded together with a single (exponent, factor) combination
+	static constexpr const uint32_t ALP_VECTOR_SIZE = 1024;
+	//! Number of values per vector that are used to find the best combination
+	static constexpr const uint32_t SAMPLES_PER_VECTOR = 32;
+	//! Maximum number of combinations that are tried for every vector during compression
+	static constexpr const uint8_t MAX_COMBINATIONS = 5;
+
+	//! Segment header: offset to the end of the metadata
+	static constexpr const idx_t HEADER_SIZE = sizeof(uint32_t);
+	//! Per vector: exponent, factor, bit width, padding, exception count, padding, frame of reference
+	static constexpr const idx_t VECTOR_HEADER_SIZE = 4 * sizeof(uint8_t) + 2 * sizeof(uint16_t) + sizeof(int64_t);
+	static constexpr const idx_t EXCEPTION_POSITION_SIZE = sizeof(uint16_t);
+	static constexpr const idx_t METADATA_POINTER_SIZE = sizeof(uint32_t);
+};
+
+template <class T>
+struct AlpTypedConstants {};
+
+template <>
+struct AlpTypedConstants<double> {
+	using SIGNED = int64_t;
+	using UNSIGNED = uint64_t;
+
+	//! 2^52 + 2^51: adding and subtracting this rounds any |x| < 2^51 to the nearest integer
+	static constexpr const double MAGIC_NUMBER = 6755399441055744.0;
+	//! Values with a larger magnitude after scaling are stored as exceptions
+	static constexpr const double ENCODING_LIMIT = 2251799813685248.0;
+	static constexpr const uint8_t MAX_EXPONENT = 18;
+
+	static constexpr const double EXP_ARR[] = {1.0,
+	                                           10.0,
+	                                           100.0,
+	                                           1000.0,
+	                                           10000.0,
+	                                           100000.0,
+	                                           1000000.0,
+	                                           10000000.0,
+	                                           100000000.0,
+	                                           1000000000.0,
+	                                           10000000000.0,
+	                                           100000000000.0,
+	                                           1000000000000.0,
+	                                           10000000000000.0,
+	                                           100000000000000.0,
+	                                           1000000000000000.0,
+	                                           10000000000000000.0,
+	                                           100000000000000000.0,
+	                                           1000000000000000000.0};
+
+	static constexpr const double FRAC_ARR[] = {1.0,   0.1,   0.01,  0.001, 0.0001, 1e-05, 1e-06,
+	                                            1e-07, 1e-08, 1e-09, 1e-10, 1e-11,  1e-12, 1e-13,
+	                                            1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+};
+
+template <>
+struct AlpTypedConstants<float> {
+	using SIGNED = int32_t;
+	using UNSIGNED = uint32_t;
+
+	//! 2^23 + 2^22: adding and subtracting this rounds any |x| < 2^22 to the nearest integer
+	static constexpr const float MAGIC_NUMBER = 12582912.0f;
+	//! Values with a larger magnitude after scaling are stored as exceptions
+	static constexpr const float ENCODING_LIMIT = 4194304.0f;
+	static constexpr const uint8_t MAX_EXPONENT = 10;
+
+	static constexpr const float EXP_ARR[] = {1.0f,         10.0f,         100.0f,        1000.0f,
+	                                          10000.0f,     100000.0f,     1000000.0f,    10000000.0f,
+	                                          100000000.0f, 1000000000.0f, 10000000000.0f};
+
+	static constexpr const float FRAC_ARR[] = {1.0f,  0.1f,  0.01f, 0.001f, 0.0001f, 1e-05f,
+	                                           1e-06f, 1e-07f, 1e-08f, 1e-09f, 1e-10f};
+};
+
+} // namespace duckdb
@@ -0,0 +1,156 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp_scan.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/alp/alp.hpp"
+
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+template <class T>
+struct AlpScanState : public SegmentScanState {
+public:
+	using EXACT_TYPE = typename FloatingToExact<T>::type;
+	using UNSIGNED = typename AlpTypedConstants<T>::UNSIGNED;
+
+	explicit AlpScanState(ColumnSegment &segment) : segment(segment), count(segment.count) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+
+		handle = buffer_manager.Pin(segment.block);
+		// ScanStates never exceed the boundaries of a Segment,
+		// but are not guaranteed to start at the beginning of the Block
+		segment_data = handle.Ptr() + segment.GetBlockOffset();
+		auto metadata_offset = Load<uint32_t>(segment_data);
+		metadata_ptr = segment_data + metadata_offset;
+	}
+
+	BufferHandle handle;
+	data_ptr_t metadata_ptr;
+	data_ptr_t segment_data;
+	idx_t total_value_count = 0;
+
+	//! The decoded values of the current vector, used when a scan does not cover an entire vector
+	T decoded_values[AlpConstants::ALP_VECTOR_SIZE];
+	UNSIGNED unpack_buffer[AlpConstants::ALP_VECTOR_SIZE];
+
+	ColumnSegment &segment;
+	idx_t count;
+
+	idx_t LeftInVector() const {
+		return AlpConstants::ALP_VECTOR_SIZE - (total_value_count % AlpConstants::ALP_VECTOR_SIZE);
+	}
+
+	inline bool VectorFinished() const {
+		return (total_value_count % AlpConstants::ALP_VECTOR_SIZE) == 0;
+	}
+
+	//! Decode the vector starting at 'total_value_count' into 'value_buffer'
+	void LoadVector(T *value_buffer) {
+		D_ASSERT(VectorFinished());
+		idx_t vector_idx = total_value_count / AlpConstants::ALP_VECTOR_SIZE;
+		// the metadata contains an offset to the data of every vector, growing backwards
+		auto data_byte_offset =
+		    Load<uint32_t>(metadata_ptr - (vector_idx + 1) * AlpConstants::METADATA_POINTER_SIZE);
+		D_ASSERT(data_byte_offset < Storage::BLOCK_SIZE);
+
+		idx_t vector_size = MinValue<idx_t>(AlpConstants::ALP_VECTOR_SIZE, count - total_value_count);
+		AlpPrimitives<T>::DecodeVector(segment_data + data_byte_offset, vector_size, value_buffer, unpack_buffer);
+	}
+
+	// Scan up to a vector boundary
+	template <bool SKIP = false>
+	void ScanVector(T *values, idx_t vector_size) {
+		D_ASSERT(vector_size <= LeftInVector());
+
+		idx_t index_in_vector = total_value_count % AlpConstants::ALP_VECTOR_SIZE;
+		if (index_in_vector == 0 && total_value_count < count) {
+			if (vector_size == MinValue<idx_t>(AlpConstants::ALP_VECTOR_SIZE, count - total_value_count)) {
+				// the entire vector is requested: decode it directly into the result, or skip it without reading it
+				if (!SKIP) {
+					LoadVector(values);
+				}
+				total_value_count += vector_size;
+				return;
+			}
+			LoadVector(decoded_values);
+		}
+		if (!SKIP) {
+			memcpy(values, decoded_values + index_in_vector, sizeof(T) * vector_size);
+		}
+		total_value_count += vector_size;
+	}
+
+public:
+	//! Skip the next 'skip_count' values, we don't store the values
+	void Skip(ColumnSegment &segment, idx_t skip_count) {
+		if (total_value_count != 0 && !VectorFinished()) {
+			// Finish skipping the current vector
+			idx_t to_skip = MinValue<idx_t>(skip_count, LeftInVector());
+			ScanVector<true>(nullptr, to_skip);
+			skip_count -= to_skip;
+		}
+		// Entire vectors can be skipped without touching their data, as the metadata allows random access
+		idx_t vectors_to_skip = skip_count / AlpConstants::ALP_VECTOR_SIZE;
+		total_value_count += vectors_to_skip * AlpConstants::ALP_VECTOR_SIZE;
+		skip_count -= vectors_to_skip * AlpConstants::ALP_VECTOR_SIZE;
+		if (skip_count == 0) {
+			return;
+		}
+		// For the last vector that this skip (partially) touches, we do need to decode the values
+		ScanVector<true>(nullptr, skip_count);
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> AlpInitScan(ColumnSegment &segment) {
+	auto result = make_uniq_base<SegmentScanState, AlpScanState<T>>(segment);
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void AlpScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                    idx_t result_offset) {
+	auto &scan_state = (AlpScanState<T> &)*state.scan_state;
+
+	// Get the pointer to the result values
+	auto current_result_ptr = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	current_result_ptr += result_offset;
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		const auto remaining = scan_count - scanned;
+		const idx_t to_scan = MinValue(remaining, scan_state.LeftInVector());
+
+		scan_state.template ScanVector<false>(current_result_ptr + scanned, to_scan);
+		scanned += to_scan;
+	}
+}
+
+template <class T>
+void AlpSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = (AlpScanState<T> &)*state.scan_state;
+	scan_state.Skip(segment, skip_count);
+}
+
+template <class T>
+void AlpScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	AlpScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+} // namespace duckdb
@@ -71,6 +71,16 @@ public:
 	//! and false otherwise
 	virtual bool Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state,
 	                  const idx_t max_count, vector<row_t> &result_ids) = 0;
+	//! Initialize a scan of the index in key order, bounded by the low and high value (a NULL value means unbounded)
+	virtual unique_ptr<IndexScanState> InitializeOrderedScan(const Transaction &transaction, const Value &low_value,
+	                                                         const ExpressionType low_expression_type,
+	                                                         const Value &high_value,
+	                                                         const ExpressionType high_expression_type) = 0;
+	//! Performs an ordered scan on the index, appending the row IDs of the next keys in key order to result_ids. The
+	//! row IDs of a key are never split across calls: keys are added while they fit into max_count row IDs, but at
+	//! least one key is added. Returns true if there are more keys to scan, and false otherwise
+	virtual bool ScanOrdered(const Transaction &transaction, const DataTable &table, IndexScanState &state,
+	                         const idx_t max_count, vector<row_t> &result_ids) = 0;
 
 	//! Obtain a lock on the index
 	virtual void InitializeLock(IndexLock &state);
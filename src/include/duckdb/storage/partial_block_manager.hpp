@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/meta_block_writer.hpp"
 #include "duckdb/storage/data_pointer.hpp"
@@ -108,6 +109,12 @@ public:
 	//! Rollback all data written by this partial block manager
 	void Rollback();
 
+	//! Obtain a lock on the partial block manager - this must be held while allocating and registering blocks when
+	//! multiple threads write to the same partial block manager (e.g. during a parallel checkpoint)
+	unique_lock<mutex> GetLock() {
+		return unique_lock<mutex>(partial_block_lock);
+	}
+
 protected:
 	BlockManager &block_manager;
 	CheckpointType checkpoint_type;
@@ -121,6 +128,8 @@ protected:
 	//! The maximum size (in bytes) at which a partial block will be considered a partial block
 	uint32_t max_partial_block_size;
 	uint32_t max_use_count;
+	//! Lock used to allocate and register blocks from multiple threads
+	mutex partial_block_lock;
 
 protected:
 	//! Try to obtain a partially filled block that can fit "segment_size" bytes
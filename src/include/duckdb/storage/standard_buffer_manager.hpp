@@ -22,6 +22,7 @@ namespace duckdb {
 class BlockManager;
 class DatabaseInstance;
 class TemporaryDirectoryHandle;
+struct TemporaryFileCompressionAdaptivity;
 struct EvictionQueue;
 
 //! The BufferManager is in charge of handling memory management for a single database. It cooperatively shares a
@@ -113,6 +114,8 @@ protected:
 
 	//! Write a temporary buffer to disk
 	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) final override;
+	//! Write a temporary buffer that was kept compressed in memory to disk
+	void WriteTemporaryBuffer(block_id_t block_id, AllocatedData &compressed_data) final override;
 	//! Read a temporary buffer from disk
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> buffer = nullptr) final override;
 	//! Get the path of the temporary buffer
@@ -122,8 +125,20 @@ protected:
 
 	void RequireTemporaryDirectory();
 
+	//! Compress an evicted temporary buffer so that it can be kept in memory, if there is room left within the
+	//! compressed_memory_limit
+	AllocatedData CompressTemporaryBuffer(FileBuffer &buffer) final override;
+	//! Decompress a temporary buffer that was kept compressed in memory
+	unique_ptr<FileBuffer> DecompressTemporaryBuffer(block_id_t id, AllocatedData &compressed_data,
+	                                                 unique_ptr<FileBuffer> buffer) final override;
+	//! Release a temporary buffer that was kept compressed in memory
+	void FreeCompressedTemporaryBuffer(AllocatedData &compressed_data) final override;
+
 	void AddToEvictionQueue(shared_ptr<BlockHandle> &handle) final override;
 
+	//! Reserve room for a compressed buffer of the given size in the compressed tier, fails if it does not fit
+	bool ReserveCompressedMemory(idx_t size, idx_t compressed_memory_limit);
+
 	const char *InMemoryWarning();
 
 	static data_ptr_t BufferAllocatorAllocate(PrivateAllocatorData *private_data, idx_t size);
@@ -146,6 +161,14 @@ protected:
 	mutex temp_handle_lock;
 	//! Handle for the temporary directory
 	unique_ptr<TemporaryDirectoryHandle> temp_directory_handle;
+	//! The amount of memory that is used by temporary buffers that are kept compressed in memory
+	atomic<idx_t> compressed_memory;
+	//! Whether or not to try compressing the next temporary buffer that is evicted
+	unique_ptr<TemporaryFileCompressionAdaptivity> compression_adaptivity;
+	//! Lock for the compression scratch buffers
+	mutex compression_buffer_lock;
+	//! Scratch buffers to compress evicted temporary buffers into, re-used across evictions
+	vector<AllocatedData> compression_buffers;
 	//! The temporary id used for managed buffers
 	atomic<block_id_t> temporary_id;
 	//! Allocator associated with the buffer manager, that passes all allocations through this buffer manager
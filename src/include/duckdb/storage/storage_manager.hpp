@@ -14,6 +14,7 @@
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/storage/database_size.hpp"
+#include "duckdb/storage/checkpoint_timings.hpp"
 
 namespace duckdb {
 class BlockManager;
@@ -69,6 +70,8 @@ public:
 	virtual void CreateCheckpoint(bool delete_wal = false, bool force_checkpoint = false) = 0;
 	virtual DatabaseSize GetDatabaseSize() = 0;
 	virtual shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) = 0;
+	//! Returns the timings of the last checkpoint
+	virtual CheckpointTimings GetCheckpointTimings() = 0;
 
 protected:
 	virtual void LoadDatabase() = 0;
@@ -113,8 +116,15 @@ public:
 	void CreateCheckpoint(bool delete_wal, bool force_checkpoint) override;
 	DatabaseSize GetDatabaseSize() override;
 	shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) override;
+	CheckpointTimings GetCheckpointTimings() override;
 
 protected:
 	void LoadDatabase() override;
+
+private:
+	//! The lock for the checkpoint timings
+	mutex timings_lock;
+	//! The timings of the last checkpoint
+	CheckpointTimings last_checkpoint_timings;
 };
 } // namespace duckdb
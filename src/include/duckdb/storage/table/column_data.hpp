@@ -165,7 +165,8 @@ protected:
 	//! The updates for this column segment
 	unique_ptr<UpdateSegment> updates;
 	//! The internal version of the column data
-	idx_t version;
+	//! This is atomic because segments can be flushed by a different thread during a parallel checkpoint
+	atomic<idx_t> version;
 	//! The stats of the root segment
 	unique_ptr<SegmentStatistics> stats;
 };
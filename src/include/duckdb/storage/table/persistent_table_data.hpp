@@ -26,6 +26,9 @@ public:
 	idx_t row_group_count;
 	block_id_t block_id;
 	idx_t offset;
+	//! If set, the table statistics and row group pointers have not been read yet. In that case, block_id and offset
+	//! point to the table statistics, and they are only read when the table is first accessed.
+	bool lazy_load;
 };
 
 } // namespace duckdb
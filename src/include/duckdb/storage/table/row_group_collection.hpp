@@ -110,6 +110,9 @@ public:
 	DataTableInfo &GetTableInfo() {
 		return *info;
 	}
+	TableStatistics &GetStatistics() {
+		return stats;
+	}
 
 private:
 	bool IsEmpty(SegmentLock &) const;
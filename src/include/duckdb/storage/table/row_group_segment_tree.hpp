@@ -26,7 +26,12 @@ public:
 protected:
 	unique_ptr<RowGroup> LoadSegment() override;
 
+	//! Opens the reader of the row group pointers
+	void InitializeReader(block_id_t block_id, idx_t offset);
+
 	RowGroupCollection &collection;
+	//! Whether or not the row group pointers are loaded lazily after the table statistics
+	bool lazy_load;
 	idx_t current_row_group;
 	idx_t max_row_group;
 	unique_ptr<MetaBlockReader> reader;
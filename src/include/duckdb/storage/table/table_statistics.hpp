@@ -9,11 +9,15 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/storage/block.hpp"
 #include "duckdb/storage/statistics/column_statistics.hpp"
 
 namespace duckdb {
+class BlockManager;
 class ColumnList;
 class PersistentTableData;
 
@@ -29,6 +33,11 @@ class TableStatistics {
 public:
 	void Initialize(const vector<LogicalType> &types, PersistentTableData &data);
 	void InitializeEmpty(const vector<LogicalType> &types);
+	//! Initialize the statistics from disk - the statistics are only deserialized when they are first accessed
+	void InitializeLazy(const vector<LogicalType> &types, BlockManager &block_manager, BlockPointer pointer);
+	//! Deserialize the statistics if they were lazily initialized and have not been loaded yet
+	//! Returns the location on disk directly after the statistics
+	BlockPointer LoadLazy();
 
 	void InitializeAddColumn(TableStatistics &parent, const LogicalType &new_column_type);
 	void InitializeRemoveColumn(TableStatistics &parent, idx_t removed_column);
@@ -55,6 +64,17 @@ private:
 	mutex stats_lock;
 	//! Column statistics
 	vector<shared_ptr<ColumnStatistics>> column_stats;
+
+	//! Whether or not the statistics still need to be deserialized
+	atomic<bool> lazy {false};
+	//! The lock for lazily loading the statistics
+	mutex load_lock;
+	//! The types of the columns (only used for lazy loading)
+	vector<LogicalType> lazy_types;
+	//! The block manager to load the statistics from (only used for lazy loading)
+	optional_ptr<BlockManager> block_manager;
+	//! Before loading: the location of the statistics. After loading: the location directly after the statistics.
+	BlockPointer lazy_pointer;
 };
 
 } // namespace duckdb
@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
@@ -19,6 +21,8 @@
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -35,13 +39,12 @@ class TypeCatalogEntry;
 class TableCatalogEntry;
 class Transaction;
 class TransactionManager;
+struct LocalAppendState;
 
 class ReplayState {
 public:
-	ReplayState(AttachedDatabase &db, ClientContext &context, Deserializer &source)
-	    : db(db), context(context), catalog(db.GetCatalog()), source(source), deserialize_only(false),
-	      checkpoint_id(INVALID_BLOCK) {
-	}
+	ReplayState(AttachedDatabase &db, ClientContext &context, Deserializer &source);
+	~ReplayState();
 
 	AttachedDatabase &db;
 	ClientContext &context;
@@ -54,6 +57,14 @@ public:
 public:
 	void ReplayEntry(WALType entry_type);
 
+	//! Replay the (already deserialized) data entries
+	void ReplayUseTable(const string &schema_name, const string &table_name);
+	void ReplayInsert(DataChunk &chunk);
+	void ReplayDelete(DataChunk &chunk);
+	void ReplayUpdate(const vector<column_t> &column_path, DataChunk &chunk);
+	//! Finalize the pending append to the current table (if any) - this has to be called before committing
+	void FlushAppend();
+
 protected:
 	virtual void ReplayCreateTable();
 	void ReplayDropTable();
@@ -86,6 +97,11 @@ protected:
 	void ReplayDelete();
 	void ReplayUpdate();
 	void ReplayCheckpoint();
+
+private:
+	//! Consecutive inserts into the same table are appended using a single append state
+	unique_ptr<LocalAppendState> append_state;
+	optional_ptr<TableCatalogEntry> append_table;
 };
 
 //! The WriteAheadLog (WAL) is a log that is used to provide durability. Prior
@@ -155,14 +171,42 @@ public:
 	void Truncate(int64_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Writes a flush marker to the WAL and makes all entries written so far durable
 	void Flush();
+	//! Writes a flush marker and all buffered entries to the WAL file without syncing the file. Returns the id of the
+	//! flush, which can be passed to SyncFlush to wait until the entries are durable.
+	idx_t WriteFlush();
+	//! Returns the id of the last flush written to the WAL file
+	idx_t GetLastFlushId();
+	//! Waits until the WAL file has been synced up to (at least) the flush with the given id. Concurrent callers are
+	//! grouped together: a single caller syncs the file on behalf of everyone that is waiting (group commit).
+	void SyncFlush(idx_t flush_id);
 
 	void WriteCheckpoint(block_id_t meta_block);
 
+protected:
+	//! Waits until no thread is syncing the WAL file, or waiting for it to be synced
+	void WaitForSyncs();
+
 protected:
 	AttachedDatabase &database;
 	unique_ptr<BufferedFileWriter> writer;
 	string wal_path;
+
+	//! The id of the last flush written to the WAL file
+	atomic<idx_t> written_flush_id;
+	//! Lock protecting the sync state below
+	mutex sync_lock;
+	//! Signalled when a sync of the WAL file finishes
+	std::condition_variable sync_finished;
+	//! The id of the last flush that is known to be durable
+	idx_t synced_flush_id;
+	//! Whether or not a thread is currently syncing the WAL file
+	bool sync_in_progress;
+	//! The number of threads that are syncing the WAL file or waiting for it to be synced
+	idx_t active_syncs;
+	//! The error that occurred while syncing the WAL file, if any - after this, no commit can be made durable anymore
+	string sync_error;
 };
 
 } // namespace duckdb
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include "duckdb/common/thread.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 class DuckTransaction;
 
@@ -33,6 +36,8 @@ public:
 	void RollbackTransaction(Transaction *transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Stops the background checkpoint thread (if any), waiting for a running checkpoint to finish
+	void StopBackgroundCheckpoints();
 
 	transaction_t LowestActiveId() {
 		return lowest_active_id;
@@ -50,6 +55,11 @@ private:
 	//! Remove the given transaction from the list of active transactions
 	void RemoveTransaction(DuckTransaction &transaction) noexcept;
 	void LockClients(vector<ClientLockWrapper> &client_locks, ClientContext &context);
+	//! Requests a checkpoint from the background checkpoint thread, starting the thread if required. Requires the
+	//! transaction lock to be held.
+	void RequestBackgroundCheckpoint();
+	//! The main loop of the background checkpoint thread
+	void RunBackgroundCheckpoints();
 
 private:
 	//! The current start timestamp used by transactions
@@ -68,8 +78,25 @@ private:
 	vector<unique_ptr<DuckTransaction>> old_transactions;
 	//! The lock used for transaction operations
 	mutex transaction_lock;
+	//! Signalled when the last active transaction finishes, when new transactions are allowed to start again, and
+	//! when a background checkpoint is requested or the background checkpoint thread has to stop
+	std::condition_variable transaction_state_changed;
 
 	bool thread_is_checkpointing;
+	//! Whether or not new transactions have to wait before starting, because a background checkpoint is waiting for
+	//! the active transactions to finish
+	bool block_new_transactions;
+	//! Whether or not a background checkpoint has been requested
+	bool checkpoint_requested;
+	//! Whether or not a background checkpoint was given up on because of long-running transactions, and has to be
+	//! retried once all transactions have finished
+	bool checkpoint_deferred;
+	//! The WAL size from which a deferred background checkpoint is requested again while transactions are active
+	idx_t checkpoint_retry_wal_size;
+	//! Whether or not the background checkpoint thread should stop
+	bool stop_background_checkpoints;
+	//! The background checkpoint thread, started on the first request for a background checkpoint
+	unique_ptr<thread> checkpoint_thread;
 };
 
 } // namespace duckdb
@@ -64,6 +64,10 @@ AttachedDatabase::~AttachedDatabase() {
 	// shutting down: attempt to checkpoint the database
 	// but only if we are not cleaning up as part of an exception unwind
 	try {
+		if (transaction_manager->IsDuckTransactionManager()) {
+			// finish any running background checkpoint first
+			DuckTransactionManager::Get(*this).StopBackgroundCheckpoints();
+		}
 		if (!storage->InMemory()) {
 			auto &config = DBConfig::GetConfig(db);
 			if (!config.options.checkpoint_on_shutdown) {
@@ -69,6 +69,22 @@ Value CheckpointThresholdSetting::GetSetting(ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Compressed Memory Limit
+//===--------------------------------------------------------------------===//
+void CompressedMemoryLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.compressed_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void CompressedMemoryLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.compressed_memory_limit = DBConfig().options.compressed_memory_limit;
+}
+
+Value CompressedMemoryLimitSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.compressed_memory_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -168,12 +184,15 @@ void DebugWindowMode::SetGlobal(DatabaseInstance *db, DBConfig &config, const Va
 	auto param = StringUtil::Lower(input.ToString());
 	if (param == "window") {
 		config.options.window_mode = WindowAggregationMode::WINDOW;
+	} else if (param == "incremental") {
+		config.options.window_mode = WindowAggregationMode::INCREMENTAL;
 	} else if (param == "combine") {
 		config.options.window_mode = WindowAggregationMode::COMBINE;
 	} else if (param == "separate") {
 		config.options.window_mode = WindowAggregationMode::SEPARATE;
 	} else {
-		throw ParserException("Unrecognized option for PRAGMA debug_window_mode, expected window, combine or separate");
+		throw ParserException("Unrecognized option for PRAGMA debug_window_mode, expected window, incremental, combine or "
+		                      "separate");
 	}
 }
 
@@ -812,6 +831,22 @@ Value MaximumMemorySetting::GetSetting(ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.maximum_memory));
 }
 
+//===--------------------------------------------------------------------===//
+// Parallel Checkpoint
+//===--------------------------------------------------------------------===//
+void ParallelCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.parallel_checkpoint = input.GetValue<bool>();
+}
+
+void ParallelCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.parallel_checkpoint = DBConfig().options.parallel_checkpoint;
+}
+
+Value ParallelCheckpointSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.parallel_checkpoint);
+}
+
 //===--------------------------------------------------------------------===//
 // Password Setting
 //===--------------------------------------------------------------------===//
@@ -1059,6 +1094,22 @@ Value TempDirectorySetting::GetSetting(ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
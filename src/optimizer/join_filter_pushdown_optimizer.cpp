@@ -0,0 +1,118 @@
+#include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+void JoinFilterPushdownOptimizer::VisitOperator(LogicalOperator &op) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_RECURSIVE_CTE:
+		// joins within a recursive CTE are executed repeatedly with different build sides
+		return;
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+		GenerateJoinFilters(op.Cast<LogicalComparisonJoin>());
+		break;
+	default:
+		break;
+	}
+	VisitOperatorChildren(op);
+}
+
+bool JoinFilterPushdownOptimizer::SupportsType(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+		// probe-side tuples without a match are discarded by these joins
+		break;
+	default:
+		return;
+	}
+	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
+		auto &cond = join.conditions[cond_idx];
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			// NOT DISTINCT FROM matches NULL values, which would be filtered out by the scan
+			continue;
+		}
+		if (cond.left->type != ExpressionType::BOUND_COLUMN_REF || !SupportsType(cond.left->return_type) ||
+		    cond.left->return_type != cond.right->return_type) {
+			continue;
+		}
+		auto &colref = cond.left->Cast<BoundColumnRefExpression>();
+		JoinFilterPushdownColumn pushdown_column;
+		pushdown_column.join_condition = cond_idx;
+		if (!FindProbeColumn(*join.children[0], colref.binding, pushdown_column)) {
+			continue;
+		}
+		join.filter_pushdown.push_back(std::move(pushdown_column));
+	}
+}
+
+bool JoinFilterPushdownOptimizer::FindProbeColumn(LogicalOperator &op, ColumnBinding binding,
+                                                  JoinFilterPushdownColumn &result) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		if (binding.table_index != proj.table_index) {
+			return false;
+		}
+		auto &expr = *proj.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		return FindProbeColumn(*op.children[0], expr.Cast<BoundColumnRefExpression>().binding, result);
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+		return FindProbeColumn(*op.children[0], binding, result);
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		// the scan feeding into the probe side of an inner join also feeds into the probe side of this join
+		auto &join = op.Cast<LogicalComparisonJoin>();
+		if (join.join_type != JoinType::INNER && join.join_type != JoinType::SEMI) {
+			return false;
+		}
+		return FindProbeColumn(*op.children[0], binding, result);
+	}
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (binding.table_index != get.table_index || !get.children.empty() || !get.function.filter_pushdown ||
+		    !get.GetTable()) {
+			return false;
+		}
+		if (binding.column_index >= get.column_ids.size() ||
+		    get.column_ids[binding.column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+			return false;
+		}
+		if (!get.dynamic_filters) {
+			get.dynamic_filters = make_shared<DynamicTableFilterSet>();
+		}
+		result.dynamic_filters = get.dynamic_filters;
+		result.scan_column_index = binding.column_index;
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -2,10 +2,101 @@
 #include "duckdb/planner/operator/logical_order.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/common/limits.hpp"
 
 namespace duckdb {
 
+//! Returns the table scan that produces the column with the given binding, looking through projections
+static optional_ptr<LogicalGet> FindTableScan(LogicalOperator &op, ColumnBinding &binding) {
+	reference<LogicalOperator> current(op);
+	while (current.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		auto &projection = current.get().Cast<LogicalProjection>();
+		if (projection.table_index != binding.table_index) {
+			return nullptr;
+		}
+		auto &expr = *projection.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return nullptr;
+		}
+		binding = expr.Cast<BoundColumnRefExpression>().binding;
+		current = *current.get().children[0];
+	}
+	if (current.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = current.get().Cast<LogicalGet>();
+	if (get.table_index != binding.table_index) {
+		return nullptr;
+	}
+	return &get;
+}
+
+//! Returns the column that an ORDER BY expression sorts on, looking through the order-preserving compression of
+//! integral columns by the statistics propagator, i.e., CAST(column - minimum AS <unsigned type>)
+static optional_ptr<BoundColumnRefExpression> GetOrderColumn(Expression &expr) {
+	reference<Expression> current(expr);
+	if (current.get().type == ExpressionType::OPERATOR_CAST) {
+		auto &cast = current.get().Cast<BoundCastExpression>();
+		switch (cast.return_type.id()) {
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+		case LogicalTypeId::UBIGINT:
+			break;
+		default:
+			// casts to other types (e.g. VARCHAR) do not necessarily preserve the order
+			return nullptr;
+		}
+		if (cast.try_cast || cast.child->type != ExpressionType::BOUND_FUNCTION) {
+			return nullptr;
+		}
+		auto &subtract = cast.child->Cast<BoundFunctionExpression>();
+		if (subtract.function.name != "-" || subtract.children.size() != 2 ||
+		    subtract.children[1]->type != ExpressionType::VALUE_CONSTANT || !subtract.return_type.IsIntegral() ||
+		    subtract.children[0]->return_type != subtract.return_type ||
+		    subtract.children[1]->return_type != subtract.return_type) {
+			return nullptr;
+		}
+		current = *subtract.children[0];
+	}
+	if (current.get().type != ExpressionType::BOUND_COLUMN_REF) {
+		return nullptr;
+	}
+	return &current.get().Cast<BoundColumnRefExpression>();
+}
+
+static void PushdownIndexOrder(LogicalTopN &topn) {
+	// the rows can be produced in order by an index if the first ORDER BY expression is an (ascending) indexed column
+	// the Top-N still sorts the rows it receives, so ties are broken by the remaining ORDER BY expressions
+	auto &order = topn.orders[0];
+	if (order.type != OrderType::ASCENDING) {
+		return;
+	}
+	auto column_ref = GetOrderColumn(*order.expression);
+	if (!column_ref) {
+		return;
+	}
+	if (topn.limit < 0 || topn.offset < 0 || topn.limit > NumericLimits<int64_t>::Maximum() - topn.offset) {
+		return;
+	}
+	auto binding = column_ref->binding;
+	auto get = FindTableScan(*topn.children[0], binding);
+	if (!get) {
+		return;
+	}
+	auto column_index = binding.column_index;
+	if (!get->projection_ids.empty()) {
+		column_index = get->projection_ids[column_index];
+	}
+	TableScanFunction::PushdownIndexOrder(*get, get->column_ids[column_index], idx_t(topn.limit + topn.offset));
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (op->type == LogicalOperatorType::LOGICAL_LIMIT &&
 	    op->children[0]->type == LogicalOperatorType::LOGICAL_ORDER_BY) {
@@ -17,6 +108,9 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		if (limit.limit_val != NumericLimits<int64_t>::Maximum() || limit.offset) {
 			auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit.limit_val, limit.offset_val);
 			topn->AddChild(std::move(order_by.children[0]));
+			if (!limit.offset) {
+				PushdownIndexOrder(*topn);
+			}
 			op = std::move(topn);
 		}
 	} else {
@@ -0,0 +1,86 @@
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <thread>
+
+namespace duckdb {
+
+TaskExecutor::TaskExecutor(TaskScheduler &scheduler)
+    : scheduler(scheduler), token(scheduler.CreateProducer()), completed_tasks(0), total_tasks(0), has_error(false) {
+}
+
+TaskExecutor::TaskExecutor(DatabaseInstance &db) : TaskExecutor(TaskScheduler::GetScheduler(db)) {
+}
+
+TaskExecutor::~TaskExecutor() {
+}
+
+void TaskExecutor::PushError(PreservedError error) {
+	lock_guard<mutex> elock(error_lock);
+	errors.push_back(std::move(error));
+	has_error = true;
+}
+
+bool TaskExecutor::HasError() {
+	return has_error;
+}
+
+void TaskExecutor::ThrowError() {
+	lock_guard<mutex> elock(error_lock);
+	D_ASSERT(!errors.empty());
+	errors[0].Throw();
+}
+
+void TaskExecutor::ScheduleTask(unique_ptr<BaseExecutorTask> task) {
+	total_tasks++;
+	scheduler.ScheduleTask(*token, std::move(task));
+}
+
+void TaskExecutor::FinishTask() {
+	completed_tasks++;
+}
+
+void TaskExecutor::WorkOnTasks() {
+	// execute tasks until all of them are finished - other threads might be working on our tasks as well
+	shared_ptr<Task> task_from_producer;
+	while (scheduler.GetTaskFromProducer(*token, task_from_producer)) {
+		auto res = task_from_producer->Execute(TaskExecutionMode::PROCESS_ALL);
+		(void)res;
+		D_ASSERT(res != TaskExecutionResult::TASK_BLOCKED);
+		task_from_producer.reset();
+	}
+	// all tasks have been handed out: wait for the tasks picked up by other threads to finish
+	// we yield instead of spinning, so the threads that are still working on our tasks are not starved of CPU time
+	while (completed_tasks < total_tasks) {
+		std::this_thread::yield();
+	}
+	if (HasError()) {
+		ThrowError();
+	}
+}
+
+BaseExecutorTask::BaseExecutorTask(TaskExecutor &executor) : executor(executor) {
+}
+
+TaskExecutionResult BaseExecutorTask::Execute(TaskExecutionMode mode) {
+	if (executor.HasError()) {
+		// another task has already failed: skip this task
+		executor.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+	try {
+		ExecuteTask();
+		executor.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	} catch (Exception &ex) {
+		executor.PushError(PreservedError(ex));
+	} catch (std::exception &ex) {
+		executor.PushError(PreservedError(ex));
+	} catch (...) { // LCOV_EXCL_START
+		executor.PushError(PreservedError("Unknown exception in BaseExecutorTask"));
+	} // LCOV_EXCL_STOP
+	executor.FinishTask();
+	return TaskExecutionResult::TASK_ERROR;
+}
+
+} // namespace duckdb
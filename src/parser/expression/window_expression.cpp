@@ -12,7 +12,7 @@ namespace duckdb {
 
 WindowExpression::WindowExpression(ExpressionType type, string catalog_name, string schema, const string &function_name)
     : ParsedExpression(type, ExpressionClass::WINDOW), catalog(std::move(catalog_name)), schema(std::move(schema)),
-      function_name(StringUtil::Lower(function_name)), ignore_nulls(false) {
+      function_name(StringUtil::Lower(function_name)), ignore_nulls(false), distinct(false) {
 	switch (type) {
 	case ExpressionType::WINDOW_AGGREGATE:
 	case ExpressionType::WINDOW_ROW_NUMBER:
@@ -68,6 +68,9 @@ bool WindowExpression::Equal(const WindowExpression &a, const WindowExpression &
 	if (a.ignore_nulls != b.ignore_nulls) {
 		return false;
 	}
+	if (a.distinct != b.distinct) {
+		return false;
+	}
 	if (!ParsedExpression::ListEquals(a.children, b.children)) {
 		return false;
 	}
@@ -130,6 +133,7 @@ unique_ptr<ParsedExpression> WindowExpression::Copy() const {
 	new_window->offset_expr = offset_expr ? offset_expr->Copy() : nullptr;
 	new_window->default_expr = default_expr ? default_expr->Copy() : nullptr;
 	new_window->ignore_nulls = ignore_nulls;
+	new_window->distinct = distinct;
 
 	return std::move(new_window);
 }
@@ -157,6 +161,7 @@ void WindowExpression::Serialize(FieldWriter &writer) const {
 	writer.WriteField<bool>(ignore_nulls);
 	writer.WriteOptional(filter_expr);
 	writer.WriteString(catalog);
+	writer.WriteField<bool>(distinct);
 }
 
 void WindowExpression::FormatSerialize(FormatSerializer &serializer) const {
@@ -175,6 +180,7 @@ void WindowExpression::FormatSerialize(FormatSerializer &serializer) const {
 	serializer.WriteProperty("ignore_nulls", ignore_nulls);
 	serializer.WriteOptionalProperty("filter_expr", filter_expr);
 	serializer.WriteProperty("catalog", catalog);
+	serializer.WriteOptionalProperty("distinct", &distinct);
 }
 
 unique_ptr<ParsedExpression> WindowExpression::FormatDeserialize(ExpressionType type,
@@ -195,6 +201,7 @@ unique_ptr<ParsedExpression> WindowExpression::FormatDeserialize(ExpressionType
 	deserializer.ReadProperty("ignore_nulls", expr->ignore_nulls);
 	deserializer.ReadOptionalProperty("filter_expr", expr->filter_expr);
 	deserializer.ReadProperty("catalog", expr->catalog);
+	deserializer.ReadOptionalPropertyOrDefault("distinct", expr->distinct, false);
 	return std::move(expr);
 }
 
@@ -220,6 +227,7 @@ unique_ptr<ParsedExpression> WindowExpression::Deserialize(ExpressionType type,
 	expr->ignore_nulls = reader.ReadRequired<bool>();
 	expr->filter_expr = reader.ReadOptional<ParsedExpression>(nullptr);
 	expr->catalog = reader.ReadField<string>(INVALID_CATALOG);
+	expr->distinct = reader.ReadField<bool>(false);
 	return std::move(expr);
 }
 
@@ -12,7 +12,7 @@ BoundWindowExpression::BoundWindowExpression(ExpressionType type, LogicalType re
                                              unique_ptr<AggregateFunction> aggregate,
                                              unique_ptr<FunctionData> bind_info)
     : Expression(type, ExpressionClass::BOUND_WINDOW, std::move(return_type)), aggregate(std::move(aggregate)),
-      bind_info(std::move(bind_info)), ignore_nulls(false) {
+      bind_info(std::move(bind_info)), ignore_nulls(false), distinct(false) {
 }
 
 string BoundWindowExpression::ToString() const {
@@ -30,6 +30,9 @@ bool BoundWindowExpression::Equals(const BaseExpression &other_p) const {
 	if (ignore_nulls != other.ignore_nulls) {
 		return false;
 	}
+	if (distinct != other.distinct) {
+		return false;
+	}
 	if (start != other.start || end != other.end) {
 		return false;
 	}
@@ -107,6 +110,7 @@ unique_ptr<Expression> BoundWindowExpression::Copy() {
 	new_window->offset_expr = offset_expr ? offset_expr->Copy() : nullptr;
 	new_window->default_expr = default_expr ? default_expr->Copy() : nullptr;
 	new_window->ignore_nulls = ignore_nulls;
+	new_window->distinct = distinct;
 
 	return std::move(new_window);
 }
@@ -132,6 +136,7 @@ void BoundWindowExpression::Serialize(FieldWriter &writer) const {
 	writer.WriteOptional(end_expr);
 	writer.WriteOptional(offset_expr);
 	writer.WriteOptional(default_expr);
+	writer.WriteField<bool>(distinct);
 }
 
 unique_ptr<Expression> BoundWindowExpression::Deserialize(ExpressionDeserializationState &state, FieldReader &reader) {
@@ -161,6 +166,7 @@ unique_ptr<Expression> BoundWindowExpression::Deserialize(ExpressionDeserializat
 	result->end_expr = reader.ReadOptional<Expression>(nullptr, state.gstate);
 	result->offset_expr = reader.ReadOptional<Expression>(nullptr, state.gstate);
 	result->default_expr = reader.ReadOptional<Expression>(nullptr, state.gstate);
+	result->distinct = reader.ReadField<bool>(false);
 	result->children = std::move(children);
 	return std::move(result);
 }
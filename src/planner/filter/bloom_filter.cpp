@@ -0,0 +1,117 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/common/field_writer.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter()
+    : BloomFilter(make_shared<vector<uint64_t>>(FILTER_BITS / (sizeof(uint64_t) * 8), 0), 0) {
+}
+
+BloomFilter::BloomFilter(shared_ptr<vector<uint64_t>> words_p, idx_t key_count)
+    : TableFilter(TableFilterType::BLOOM_FILTER), key_count(key_count), words(std::move(words_p)) {
+	D_ASSERT(IsPowerOfTwo(words->size()));
+}
+
+uint64_t BloomFilter::KeyMask(hash_t hash) {
+	// the lower bits of the hash select the word, the upper bits select the bits within the word
+	uint64_t mask = 0;
+	for (idx_t i = 0; i < BITS_PER_KEY; i++) {
+		mask |= uint64_t(1) << ((hash >> (64 - 6 * (i + 1))) & 63);
+	}
+	return mask;
+}
+
+void BloomFilter::Insert(Vector &keys, idx_t count) {
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(keys, hashes, count);
+	UnifiedVectorFormat kdata;
+	keys.ToUnifiedFormat(count, kdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	auto &filter = *words;
+	auto word_mask = filter.size() - 1;
+	for (idx_t i = 0; i < count; i++) {
+		if (!kdata.validity.RowIsValid(kdata.sel->get_index(i))) {
+			continue;
+		}
+		auto hash = hash_data[hdata.sel->get_index(i)];
+		filter[hash & word_mask] |= KeyMask(hash);
+		key_count++;
+	}
+}
+
+void BloomFilter::Merge(const BloomFilter &other) {
+	D_ASSERT(words->size() == other.words->size());
+	auto &filter = *words;
+	auto &other_filter = *other.words;
+	for (idx_t i = 0; i < filter.size(); i++) {
+		filter[i] |= other_filter[i];
+	}
+	key_count += other.key_count;
+}
+
+idx_t BloomFilter::Select(Vector &input, SelectionVector &sel, idx_t &approved_tuple_count,
+                          ValidityMask &mask) const {
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, sel, approved_tuple_count);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(STANDARD_VECTOR_SIZE, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	auto &filter = *words;
+	auto word_mask = filter.size() - 1;
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!mask.RowIsValid(idx)) {
+			continue;
+		}
+		auto hash = hash_data[hdata.sel->get_index(idx)];
+		auto key_mask = KeyMask(hash);
+		if ((filter[hash & word_mask] & key_mask) == key_mask) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// the zonemaps only hold the min/max: the filter is checked on the values themselves
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM FILTER";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return *other.words == *words;
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(words, key_count);
+}
+
+void BloomFilter::Serialize(FieldWriter &writer) const {
+	writer.WriteField<idx_t>(key_count);
+	writer.WriteList<uint64_t>(*words);
+}
+
+unique_ptr<TableFilter> BloomFilter::Deserialize(FieldReader &source) {
+	auto key_count = source.ReadRequired<idx_t>();
+	auto words = make_shared<vector<uint64_t>>(source.ReadRequiredList<uint64_t>());
+	return make_uniq<BloomFilter>(std::move(words), key_count);
+}
+
+} // namespace duckdb
@@ -47,6 +47,14 @@ bool ConjunctionOrFilter::Equals(const TableFilter &other_p) const {
 	return true;
 }
 
+unique_ptr<TableFilter> ConjunctionOrFilter::Copy() const {
+	auto result = make_uniq<ConjunctionOrFilter>();
+	for (auto &child_filter : child_filters) {
+		result->child_filters.push_back(child_filter->Copy());
+	}
+	return std::move(result);
+}
+
 void ConjunctionOrFilter::Serialize(FieldWriter &writer) const {
 	writer.WriteSerializableList(child_filters);
 }
@@ -102,6 +110,14 @@ bool ConjunctionAndFilter::Equals(const TableFilter &other_p) const {
 	return true;
 }
 
+unique_ptr<TableFilter> ConjunctionAndFilter::Copy() const {
+	auto result = make_uniq<ConjunctionAndFilter>();
+	for (auto &child_filter : child_filters) {
+		result->child_filters.push_back(child_filter->Copy());
+	}
+	return std::move(result);
+}
+
 void ConjunctionAndFilter::Serialize(FieldWriter &writer) const {
 	writer.WriteSerializableList(child_filters);
 }
@@ -43,6 +43,10 @@ bool ConstantFilter::Equals(const TableFilter &other_p) const {
 	return other.comparison_type == comparison_type && other.constant == constant;
 }
 
+unique_ptr<TableFilter> ConstantFilter::Copy() const {
+	return make_uniq<ConstantFilter>(comparison_type, constant);
+}
+
 void ConstantFilter::Serialize(FieldWriter &writer) const {
 	writer.WriteField(comparison_type);
 	writer.WriteSerializable(constant);
@@ -1,5 +1,6 @@
 #include "duckdb/common/field_writer.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
@@ -25,6 +26,43 @@ void TableFilterSet::PushFilter(idx_t column_index, unique_ptr<TableFilter> filt
 	}
 }
 
+void DynamicTableFilterSet::ClearFilters(const PhysicalOperator &op) {
+	lock_guard<mutex> l(lock);
+	filters.erase(op);
+}
+
+void DynamicTableFilterSet::PushFilter(const PhysicalOperator &op, idx_t column_index,
+                                       unique_ptr<TableFilter> filter) {
+	lock_guard<mutex> l(lock);
+	auto entry = filters.find(op);
+	if (entry == filters.end()) {
+		entry = filters.insert(make_pair(reference<const PhysicalOperator>(op), make_uniq<TableFilterSet>())).first;
+	}
+	entry->second->PushFilter(column_index, std::move(filter));
+}
+
+bool DynamicTableFilterSet::HasFilters() const {
+	lock_guard<mutex> l(lock);
+	return !filters.empty();
+}
+
+unique_ptr<TableFilterSet>
+DynamicTableFilterSet::GetFinalTableFilters(optional_ptr<TableFilterSet> existing_filters) const {
+	auto result = make_uniq<TableFilterSet>();
+	if (existing_filters) {
+		for (auto &entry : existing_filters->filters) {
+			result->PushFilter(entry.first, entry.second->Copy());
+		}
+	}
+	lock_guard<mutex> l(lock);
+	for (auto &op_filters : filters) {
+		for (auto &entry : op_filters.second->filters) {
+			result->PushFilter(entry.first, entry.second->Copy());
+		}
+	}
+	return result;
+}
+
 //! Serializes a LogicalType to a stand-alone binary blob
 void TableFilterSet::Serialize(Serializer &serializer) const {
 	serializer.Write<idx_t>(filters.size());
@@ -76,6 +114,9 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &source) {
 	case TableFilterType::IS_NULL:
 		result = IsNullFilter::Deserialize(reader);
 		break;
+	case TableFilterType::BLOOM_FILTER:
+		result = BloomFilter::Deserialize(reader);
+		break;
 	default:
 		throw NotImplementedException("Unsupported table filter type for deserialization");
 	}
@@ -36,6 +36,9 @@ BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
 		// the block is still loaded in memory: erase it
 		buffer.reset();
 		memory_charge.Resize(0);
+	} else if (IsCompressed()) {
+		// the block is kept compressed in memory: release the compressed data
+		FreeCompressedData();
 	} else {
 		D_ASSERT(memory_charge.size == 0);
 	}
@@ -77,6 +80,11 @@ BufferHandle BlockHandle::Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileB
 	} else {
 		if (handle->can_destroy) {
 			return BufferHandle();
+		} else if (handle->IsCompressed()) {
+			// the block was kept compressed in memory: decompress it
+			handle->buffer = block_manager.buffer_manager.DecompressTemporaryBuffer(
+			    handle->block_id, handle->compressed_data, std::move(reusable_buffer));
+			handle->FreeCompressedData();
 		} else {
 			handle->buffer =
 			    block_manager.buffer_manager.ReadTemporaryBuffer(handle->block_id, std::move(reusable_buffer));
@@ -88,6 +96,11 @@ BufferHandle BlockHandle::Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileB
 
 unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock() {
 	if (state == BlockState::BLOCK_UNLOADED) {
+		if (IsCompressed()) {
+			// the block is kept compressed in memory: write the compressed data to a temporary file
+			block_manager.buffer_manager.WriteTemporaryBuffer(block_id, compressed_data);
+			FreeCompressedData();
+		}
 		// already unloaded: nothing to do
 		return nullptr;
 	}
@@ -95,10 +108,15 @@ unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock() {
 	D_ASSERT(CanUnload());
 
 	if (block_id >= MAXIMUM_BLOCK && !can_destroy) {
-		// temporary block that cannot be destroyed: write to temporary file
-		block_manager.buffer_manager.WriteTemporaryBuffer(block_id, *buffer);
+		// temporary block that cannot be destroyed: keep it compressed in memory if there is room for it
+		// otherwise write it to a temporary file
+		compressed_data = block_manager.buffer_manager.CompressTemporaryBuffer(*buffer);
+		if (!IsCompressed()) {
+			block_manager.buffer_manager.WriteTemporaryBuffer(block_id, *buffer);
+		}
 	}
-	memory_charge.Resize(0);
+	// the compressed data (if any) remains charged to the buffer pool
+	memory_charge.Resize(compressed_data.GetSize());
 	state = BlockState::BLOCK_UNLOADED;
 	return std::move(buffer);
 }
@@ -109,7 +127,7 @@ void BlockHandle::Unload() {
 }
 
 bool BlockHandle::CanUnload() {
-	if (state == BlockState::BLOCK_UNLOADED) {
+	if (state == BlockState::BLOCK_UNLOADED && !IsCompressed()) {
 		// already unloaded
 		return false;
 	}
@@ -126,4 +144,10 @@ bool BlockHandle::CanUnload() {
 	return true;
 }
 
+void BlockHandle::FreeCompressedData() {
+	D_ASSERT(IsCompressed());
+	block_manager.buffer_manager.FreeCompressedTemporaryBuffer(compressed_data);
+	memory_charge.Resize(0);
+}
+
 } // namespace duckdb
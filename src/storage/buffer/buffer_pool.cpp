@@ -8,6 +8,8 @@ typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
 struct EvictionQueue {
 	eviction_queue_t q;
+	//! Blocks that are kept compressed in memory: these are only written to disk once no loaded block can be evicted
+	eviction_queue_t compressed_q;
 };
 
 bool BufferEvictionNode::CanUnload(BlockHandle &handle_p) {
@@ -47,7 +49,8 @@ void BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	if ((++queue_insertions % INSERT_INTERVAL) == 0) {
 		PurgeQueue();
 	}
-	queue->q.enqueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp));
+	auto &q = handle->IsCompressed() ? queue->compressed_q : queue->q;
+	q.enqueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp));
 }
 
 void BufferPool::IncreaseUsedMemory(idx_t size) {
@@ -66,8 +69,8 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(idx_t extra_memory, idx_t mem
 	BufferEvictionNode node;
 	TempBufferPoolReservation r(*this, extra_memory);
 	while (current_memory > memory_limit) {
-		// get a block to unpin from the queue
-		if (!queue->q.try_dequeue(node)) {
+		// get a block to unpin from the queue, or a compressed block to write to disk if there is none left
+		if (!queue->q.try_dequeue(node) && !queue->compressed_q.try_dequeue(node)) {
 			// Failed to reserve. Adjust size of temp reservation to 0.
 			r.Resize(0);
 			return {false, std::move(r)};
@@ -84,34 +87,43 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(idx_t extra_memory, idx_t mem
 			continue;
 		}
 		// hooray, we can unload the block
-		if (buffer && handle->buffer->AllocSize() == extra_memory) {
+		if (buffer && !*buffer && handle->buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can actually re-use the memory directly!
 			*buffer = handle->UnloadAndTakeBlock();
-			return {true, std::move(r)};
 		} else {
 			// release the memory and mark the block as unloaded
 			handle->Unload();
 		}
+		if (handle->IsCompressed()) {
+			// the block is kept compressed in memory: its compressed data is still charged to the pool, so we keep
+			// evicting until we are under the limit. It can still be written to disk later on
+			AddToEvictionQueue(handle);
+		}
 	}
 	return {true, std::move(r)};
 }
 
-void BufferPool::PurgeQueue() {
+static void PurgeEvictionQueue(eviction_queue_t &q) {
 	BufferEvictionNode node;
 	while (true) {
-		if (!queue->q.try_dequeue(node)) {
+		if (!q.try_dequeue(node)) {
 			break;
 		}
 		auto handle = node.TryGetBlockHandle();
 		if (!handle) {
 			continue;
 		} else {
-			queue->q.enqueue(std::move(node));
+			q.enqueue(std::move(node));
 			break;
 		}
 	}
 }
 
+void BufferPool::PurgeQueue() {
+	PurgeEvictionQueue(queue->q);
+	PurgeEvictionQueue(queue->compressed_q);
+}
+
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
 	lock_guard<mutex> l_lock(limit_lock);
 	// try to evict until the limit is reached
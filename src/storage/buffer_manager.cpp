@@ -76,4 +76,22 @@ void BufferManager::DeleteTemporaryFile(block_id_t id) {
 	throw NotImplementedException("This type of BufferManager does not support 'DeleteTemporaryFile");
 }
 
+void BufferManager::WriteTemporaryBuffer(block_id_t block_id, AllocatedData &compressed_data) {
+	throw NotImplementedException("This type of BufferManager does not support 'WriteTemporaryBuffer");
+}
+
+AllocatedData BufferManager::CompressTemporaryBuffer(FileBuffer &buffer) {
+	// no compressed buffers are kept in memory: the buffer is written to disk
+	return AllocatedData();
+}
+
+unique_ptr<FileBuffer> BufferManager::DecompressTemporaryBuffer(block_id_t id, AllocatedData &compressed_data,
+                                                                unique_ptr<FileBuffer> buffer) {
+	throw NotImplementedException("This type of BufferManager does not support 'DecompressTemporaryBuffer");
+}
+
+void BufferManager::FreeCompressedTemporaryBuffer(AllocatedData &compressed_data) {
+	throw NotImplementedException("This type of BufferManager does not support 'FreeCompressedTemporaryBuffer");
+}
+
 } // namespace duckdb
@@ -2,6 +2,7 @@
 
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/common/serializer/buffered_serializer.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
@@ -41,7 +42,14 @@ unique_ptr<RowGroupWriter> SingleFileTableDataWriter::GetRowGroupWriter(RowGroup
 	return make_uniq<SingleFileRowGroupWriter>(table, checkpoint_manager.partial_block_manager, table_data_writer);
 }
 
+CheckpointTimings &SingleFileTableDataWriter::GetCheckpointTimings() {
+	return checkpoint_manager.timings;
+}
+
 void SingleFileTableDataWriter::FinalizeTable(TableStatistics &&global_stats, DataTableInfo *info) {
+	Profiler profiler;
+	profiler.Start();
+
 	// store the current position in the metadata writer
 	// this is where the row groups for this table start
 	auto pointer = table_data_writer.GetBlockPointer();
@@ -73,6 +81,8 @@ void SingleFileTableDataWriter::FinalizeTable(TableStatistics &&global_stats, Da
 		meta_data_writer.Write<idx_t>(block_info.block_id);
 		meta_data_writer.Write<idx_t>(block_info.offset);
 	}
+	profiler.End();
+	checkpoint_manager.timings.write_table_metadata += profiler.Elapsed();
 }
 
 } // namespace duckdb
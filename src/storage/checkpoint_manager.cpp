@@ -9,6 +9,7 @@
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
 #include "duckdb/common/field_writer.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/serializer.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -62,6 +63,9 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	// assert that the checkpoint manager hasn't been used before
 	D_ASSERT(!metadata_writer);
 
+	Profiler total_profiler;
+	total_profiler.Start();
+
 	auto &block_manager = GetBlockManager();
 
 	//! Set up the writers for the checkpoints
@@ -81,7 +85,13 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	for (auto &schema : schemas) {
 		WriteSchema(schema.get());
 	}
+	Profiler profiler;
+	profiler.Start();
 	partial_block_manager.FlushPartialBlocks();
+	profiler.End();
+	timings.flush_partial_blocks = profiler.Elapsed();
+
+	profiler.Start();
 	// flush the meta data to disk
 	metadata_writer->Flush();
 	table_metadata_writer->Flush();
@@ -114,6 +124,11 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	// mark all blocks written as part of the metadata as modified
 	metadata_writer->MarkWrittenBlocks();
 	table_metadata_writer->MarkWrittenBlocks();
+
+	profiler.End();
+	timings.write_header = profiler.Elapsed();
+	total_profiler.End();
+	timings.total = total_profiler.Elapsed();
 }
 
 void SingleFileCheckpointReader::LoadFromStorage() {
@@ -469,13 +484,21 @@ void CheckpointReader::ReadTableData(ClientContext &context, MetaBlockReader &re
                                      BoundCreateTableInfo &bound_info) {
 	auto block_id = reader.Read<block_id_t>();
 	auto offset = reader.Read<uint64_t>();
-
-	MetaBlockReader table_data_reader(reader.block_manager, block_id);
-	table_data_reader.offset = offset;
-	TableDataReader data_reader(table_data_reader, bound_info);
-
-	data_reader.ReadTableData();
-	bound_info.data->total_rows = reader.Read<idx_t>();
+	auto total_rows = reader.Read<idx_t>();
+
+	if (total_rows > 0) {
+		// the table statistics and row group pointers are read lazily when the table is first accessed
+		bound_info.data = make_uniq<PersistentTableData>(bound_info.Base().columns.LogicalColumnCount());
+		bound_info.data->block_id = block_id;
+		bound_info.data->offset = offset;
+		bound_info.data->lazy_load = true;
+	} else {
+		MetaBlockReader table_data_reader(reader.block_manager, block_id);
+		table_data_reader.offset = offset;
+		TableDataReader data_reader(table_data_reader, bound_info);
+		data_reader.ReadTableData();
+	}
+	bound_info.data->total_rows = total_rows;
 
 	// Get any indexes block info
 	idx_t num_indexes = reader.Read<idx_t>();
@@ -0,0 +1,50 @@
+#include "duckdb/storage/compression/alp/alp.hpp"
+#include "duckdb/storage/compression/alp/alp_analyze.hpp"
+#include "duckdb/storage/compression/alp/alp_compress.hpp"
+#include "duckdb/storage/compression/alp/alp_scan.hpp"
+#include "duckdb/storage/compression/alp/alp_fetch.hpp"
+
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+
+namespace duckdb {
+
+constexpr const double AlpTypedConstants<double>::MAGIC_NUMBER;
+constexpr const double AlpTypedConstants<double>::ENCODING_LIMIT;
+constexpr const double AlpTypedConstants<double>::EXP_ARR[];
+constexpr const double AlpTypedConstants<double>::FRAC_ARR[];
+
+constexpr const float AlpTypedConstants<float>::MAGIC_NUMBER;
+constexpr const float AlpTypedConstants<float>::ENCODING_LIMIT;
+constexpr const float AlpTypedConstants<float>::EXP_ARR[];
+constexpr const float AlpTypedConstants<float>::FRAC_ARR[];
+
+template <class T>
+CompressionFunction GetAlpFunction(PhysicalType data_type) {
+	return CompressionFunction(CompressionType::COMPRESSION_ALP, data_type, AlpInitAnalyze<T>, AlpAnalyze<T>,
+	                           AlpFinalAnalyze<T>, AlpInitCompression<T>, AlpCompress<T>, AlpFinalizeCompress<T>,
+	                           AlpInitScan<T>, AlpScan<T>, AlpScanPartial<T>, AlpFetchRow<T>, AlpSkip<T>);
+}
+
+CompressionFunction AlpCompressionFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::FLOAT:
+		return GetAlpFunction<float>(type);
+	case PhysicalType::DOUBLE:
+		return GetAlpFunction<double>(type);
+	default:
+		throw InternalException("Unsupported type for ALP");
+	}
+}
+
+bool AlpCompressionFun::TypeIsSupported(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
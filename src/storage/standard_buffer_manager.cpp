@@ -8,6 +8,7 @@
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
+#include "miniz.hpp"
 
 namespace duckdb {
 
@@ -33,6 +34,67 @@ unique_ptr<FileBuffer> StandardBufferManager::ConstructManagedBuffer(idx_t size,
 	return result;
 }
 
+//! Compressed blocks are written to temporary files with slots that are a multiple of this size
+static constexpr idx_t TEMPORARY_SLOT_GRANULARITY = 32768;
+
+//! Decides whether evicted blocks should be compressed: once a block turns out to be incompressible, compression is
+//! skipped for the next few blocks to avoid spending CPU time on data that does not compress
+struct TemporaryFileCompressionAdaptivity {
+	static constexpr idx_t INCOMPRESSIBLE_SKIP_COUNT = 16;
+
+public:
+	TemporaryFileCompressionAdaptivity() : skip_count(0) {
+	}
+
+	bool ShouldCompress() {
+		auto skip = skip_count.load();
+		if (skip == 0) {
+			return true;
+		}
+		skip_count.compare_exchange_strong(skip, skip - 1);
+		return false;
+	}
+
+	void Update(bool compressible) {
+		if (!compressible) {
+			skip_count = INCOMPRESSIBLE_SKIP_COUNT;
+		}
+	}
+
+private:
+	atomic<idx_t> skip_count;
+};
+
+//! Compresses a block-sized buffer. Returns the compressed size, or 0 if the compressed buffer would not save at least
+//! one slot in a temporary file (in which case the buffer is not worth compressing)
+//! The compressed buffer is only allocated if it is not set yet, so that a scratch buffer can be re-used across calls
+static idx_t CompressTemporaryBlock(Allocator &allocator, FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	auto max_compressed_size = Storage::BLOCK_ALLOC_SIZE - TEMPORARY_SLOT_GRANULARITY;
+	if (!compressed_buffer.IsSet()) {
+		compressed_buffer = allocator.Allocate(max_compressed_size);
+	}
+	D_ASSERT(compressed_buffer.GetSize() == max_compressed_size);
+	duckdb_miniz::mz_ulong compressed_size = max_compressed_size;
+	auto mz_ret = duckdb_miniz::mz_compress2(compressed_buffer.get(), &compressed_size, buffer.InternalBuffer(),
+	                                         buffer.AllocSize(), duckdb_miniz::MZ_BEST_SPEED);
+	if (mz_ret != duckdb_miniz::MZ_OK) {
+		return 0;
+	}
+	return compressed_size;
+}
+
+//! Decompresses a block-sized buffer that was compressed with CompressTemporaryBlock
+static void DecompressTemporaryBlock(FileBuffer &buffer, const_data_ptr_t compressed_buffer, idx_t compressed_size,
+                                     block_id_t id) {
+	duckdb_miniz::mz_ulong uncompressed_size = buffer.AllocSize();
+	auto mz_ret =
+	    duckdb_miniz::mz_uncompress(buffer.InternalBuffer(), &uncompressed_size, compressed_buffer, compressed_size);
+	if (mz_ret != duckdb_miniz::MZ_OK || uncompressed_size != buffer.AllocSize()) {
+		throw IOException("Failed to decompress temporary block %llu", id);
+	}
+}
+
 class TemporaryFileManager;
 
 class TemporaryDirectoryHandle {
@@ -58,6 +120,7 @@ void StandardBufferManager::SetTemporaryDirectory(const string &new_dir) {
 
 StandardBufferManager::StandardBufferManager(DatabaseInstance &db, string tmp)
     : BufferManager(), db(db), buffer_pool(db.GetBufferPool()), temp_directory(std::move(tmp)),
+      compressed_memory(0), compression_adaptivity(make_uniq<TemporaryFileCompressionAdaptivity>()),
       temporary_id(MAXIMUM_BLOCK), buffer_allocator(BufferAllocatorAllocate, BufferAllocatorFree,
                                                     BufferAllocatorRealloc, make_uniq<BufferAllocatorData>(*this)) {
 	temp_block_manager = make_uniq<InMemoryBlockManager>(*this);
@@ -249,11 +312,13 @@ unique_ptr<FileBuffer> ReadTemporaryBufferInternal(BufferManager &buffer_manager
 struct TemporaryFileIndex {
 	explicit TemporaryFileIndex(idx_t file_index = DConstants::INVALID_INDEX,
 	                            idx_t block_index = DConstants::INVALID_INDEX)
-	    : file_index(file_index), block_index(block_index) {
+	    : file_index(file_index), block_index(block_index), compressed_size(0) {
 	}
 
 	idx_t file_index;
 	idx_t block_index;
+	//! The size of the block on disk if it was compressed (0 otherwise)
+	idx_t compressed_size;
 
 public:
 	bool IsValid() {
@@ -308,6 +373,10 @@ public:
 		return max_index;
 	}
 
+	idx_t GetUsedIndexCount() {
+		return indexes_in_use.size();
+	}
+
 	bool HasFreeBlocks() {
 		return !free_indexes.empty();
 	}
@@ -332,9 +401,10 @@ class TemporaryFileHandle {
 	constexpr static idx_t MAX_ALLOWED_INDEX = 4000;
 
 public:
-	TemporaryFileHandle(DatabaseInstance &db, const string &temp_directory, idx_t index)
-	    : db(db), file_index(index), path(FileSystem::GetFileSystem(db).JoinPath(
-	                                     temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")) {
+	TemporaryFileHandle(DatabaseInstance &db, const string &temp_directory, idx_t index, idx_t slot_size)
+	    : db(db), file_index(index), slot_size(slot_size),
+	      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory,
+	                                                  "duckdb_temp_storage-" + to_string(index) + ".tmp")) {
 	}
 
 public:
@@ -361,13 +431,29 @@ public:
 
 	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
 		D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+		D_ASSERT(!IsCompressed());
 		buffer.Write(*handle, GetPositionInFile(index.block_index));
 	}
 
-	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, idx_t block_index,
+	void WriteTemporaryFile(AllocatedData &compressed_buffer, TemporaryFileIndex index) {
+		D_ASSERT(IsCompressed() && index.compressed_size <= slot_size);
+		handle->Write(compressed_buffer.get(), index.compressed_size, GetPositionInFile(index.block_index));
+	}
+
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, TemporaryFileIndex index,
 	                                           unique_ptr<FileBuffer> reusable_buffer) {
-		return ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-		                                   Storage::BLOCK_SIZE, id, std::move(reusable_buffer));
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		if (!IsCompressed()) {
+			return ReadTemporaryBufferInternal(buffer_manager, *handle, GetPositionInFile(index.block_index),
+			                                   Storage::BLOCK_SIZE, id, std::move(reusable_buffer));
+		}
+		// read the compressed block and decompress it into a new buffer
+		auto compressed_buffer = Allocator::Get(db).Allocate(index.compressed_size);
+		handle->Read(compressed_buffer.get(), index.compressed_size, GetPositionInFile(index.block_index));
+
+		auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+		DecompressTemporaryBlock(*buffer, compressed_buffer.get(), index.compressed_size, id);
+		return buffer;
 	}
 
 	void EraseBlockIndex(block_id_t block_index) {
@@ -395,9 +481,21 @@ public:
 		TemporaryFileInformation info;
 		info.path = path;
 		info.size = GetPositionInFile(index_manager.GetMaxIndex());
+		info.block_size = slot_size;
+		info.block_count = index_manager.GetUsedIndexCount();
 		return info;
 	}
 
+	//! The size of each block slot in this file
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
+
+	//! Whether or not this file stores compressed blocks
+	bool IsCompressed() const {
+		return slot_size < Storage::BLOCK_ALLOC_SIZE;
+	}
+
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &) {
 		if (handle) {
@@ -422,13 +520,15 @@ private:
 	}
 
 	idx_t GetPositionInFile(idx_t index) {
-		return index * Storage::BLOCK_ALLOC_SIZE;
+		return index * slot_size;
 	}
 
 private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	//! The size of each block slot in this file: Storage::BLOCK_ALLOC_SIZE, or less if the blocks are compressed
+	idx_t slot_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
@@ -450,37 +550,25 @@ public:
 
 	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 		D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
-		TemporaryFileIndex index;
-		TemporaryFileHandle *handle = nullptr;
-
-		{
-			TemporaryManagerLock lock(manager_lock);
-			// first check if we can write to an open existing file
-			for (auto &entry : files) {
-				auto &temp_file = entry.second;
-				index = temp_file->TryGetBlockIndex();
-				if (index.IsValid()) {
-					handle = entry.second.get();
-					break;
-				}
-			}
-			if (!handle) {
-				// no existing handle to write to; we need to create & open a new file
-				auto new_file_index = index_manager.GetNewBlockIndex();
-				auto new_file = make_uniq<TemporaryFileHandle>(db, temp_directory, new_file_index);
-				handle = new_file.get();
-				files[new_file_index] = std::move(new_file);
-
-				index = handle->TryGetBlockIndex();
-			}
-			D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
-			used_blocks[block_id] = index;
+		// try to compress the buffer first: compressed buffers are written to files with smaller slots
+		AllocatedData compressed_buffer;
+		idx_t compressed_size = CompressBuffer(buffer, compressed_buffer);
+		if (compressed_size > 0) {
+			WriteTemporaryBuffer(block_id, compressed_buffer, compressed_size);
+			return;
 		}
-		D_ASSERT(handle);
-		D_ASSERT(index.IsValid());
+		TemporaryFileHandle *handle;
+		auto index = GetNewBlockIndex(block_id, Storage::BLOCK_ALLOC_SIZE, 0, handle);
 		handle->WriteTemporaryFile(buffer, index);
 	}
 
+	void WriteTemporaryBuffer(block_id_t block_id, AllocatedData &compressed_buffer, idx_t compressed_size) {
+		auto slot_size = AlignValue<idx_t, TEMPORARY_SLOT_GRANULARITY>(compressed_size);
+		TemporaryFileHandle *handle;
+		auto index = GetNewBlockIndex(block_id, slot_size, compressed_size, handle);
+		handle->WriteTemporaryFile(compressed_buffer, index);
+	}
+
 	bool HasTemporaryBuffer(block_id_t block_id) {
 		lock_guard<mutex> lock(manager_lock);
 		return used_blocks.find(block_id) != used_blocks.end();
@@ -494,7 +582,7 @@ public:
 			index = GetTempBlockIndex(lock, id);
 			handle = GetFileHandle(lock, index.file_index);
 		}
-		auto buffer = handle->ReadTemporaryBuffer(id, index.block_index, std::move(reusable_buffer));
+		auto buffer = handle->ReadTemporaryBuffer(id, index, std::move(reusable_buffer));
 		{
 			// remove the block (and potentially erase the temp file)
 			TemporaryManagerLock lock(manager_lock);
@@ -520,6 +608,53 @@ public:
 	}
 
 private:
+	//! Compresses the buffer if temp_file_compression is enabled and that saves at least one slot in the temporary
+	//! file. Returns the compressed size, or 0 if the buffer should be written uncompressed.
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+		if (!DBConfig::GetConfig(db).options.temp_file_compression || !compression_adaptivity.ShouldCompress()) {
+			return 0;
+		}
+		auto compressed_size = CompressTemporaryBlock(Allocator::Get(db), buffer, compressed_buffer);
+		compression_adaptivity.Update(compressed_size > 0);
+		return compressed_size;
+	}
+
+	//! Finds a free slot of the given size for the block in one of the temporary files, creating a new file if needed
+	TemporaryFileIndex GetNewBlockIndex(block_id_t block_id, idx_t slot_size, idx_t compressed_size,
+	                                    TemporaryFileHandle *&handle) {
+		TemporaryFileIndex index;
+		handle = nullptr;
+
+		TemporaryManagerLock lock(manager_lock);
+		// first check if we can write to an open existing file
+		for (auto &entry : files) {
+			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
+			index = temp_file->TryGetBlockIndex();
+			if (index.IsValid()) {
+				handle = entry.second.get();
+				break;
+			}
+		}
+		if (!handle) {
+			// no existing handle to write to; we need to create & open a new file
+			auto new_file_index = index_manager.GetNewBlockIndex();
+			auto new_file = make_uniq<TemporaryFileHandle>(db, temp_directory, new_file_index, slot_size);
+			handle = new_file.get();
+			files[new_file_index] = std::move(new_file);
+
+			index = handle->TryGetBlockIndex();
+		}
+		D_ASSERT(handle);
+		D_ASSERT(index.IsValid());
+		index.compressed_size = compressed_size;
+		D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
+		used_blocks[block_id] = index;
+		return index;
+	}
+
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index) {
 		auto entry = used_blocks.find(id);
@@ -558,6 +693,8 @@ private:
 	unordered_map<block_id_t, TemporaryFileIndex> used_blocks;
 	//! Manager of in-use temporary file indexes
 	BlockIndexManager index_manager;
+	//! Whether or not to try compressing the next evicted block
+	TemporaryFileCompressionAdaptivity compression_adaptivity;
 };
 
 TemporaryDirectoryHandle::TemporaryDirectoryHandle(DatabaseInstance &db, string path_p)
@@ -641,6 +778,11 @@ void StandardBufferManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	buffer.Write(*handle, sizeof(idx_t));
 }
 
+void StandardBufferManager::WriteTemporaryBuffer(block_id_t block_id, AllocatedData &compressed_data) {
+	RequireTemporaryDirectory();
+	temp_directory_handle->GetTempFile().WriteTemporaryBuffer(block_id, compressed_data, compressed_data.GetSize());
+}
+
 unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(block_id_t id,
                                                                   unique_ptr<FileBuffer> reusable_buffer) {
 	D_ASSERT(!temp_directory.empty());
@@ -688,6 +830,61 @@ void StandardBufferManager::DeleteTemporaryFile(block_id_t id) {
 	}
 }
 
+AllocatedData StandardBufferManager::CompressTemporaryBuffer(FileBuffer &buffer) {
+	auto compressed_memory_limit = DBConfig::GetConfig(db).options.compressed_memory_limit;
+	if (buffer.size != Storage::BLOCK_SIZE || compressed_memory >= compressed_memory_limit) {
+		// the compressed tier is disabled or full: the buffer is written to disk
+		return AllocatedData();
+	}
+	if (!compression_adaptivity->ShouldCompress()) {
+		return AllocatedData();
+	}
+	auto &allocator = Allocator::Get(db);
+	// compress into a scratch buffer that is re-used across evictions
+	AllocatedData compressed_buffer;
+	{
+		lock_guard<mutex> guard(compression_buffer_lock);
+		if (!compression_buffers.empty()) {
+			compressed_buffer = std::move(compression_buffers.back());
+			compression_buffers.pop_back();
+		}
+	}
+	auto compressed_size = CompressTemporaryBlock(allocator, buffer, compressed_buffer);
+	compression_adaptivity->Update(compressed_size > 0);
+	AllocatedData result;
+	if (compressed_size > 0 && ReserveCompressedMemory(compressed_size, compressed_memory_limit)) {
+		// copy the compressed data into an allocation of the exact size
+		result = allocator.Allocate(compressed_size);
+		memcpy(result.get(), compressed_buffer.get(), compressed_size);
+	}
+	lock_guard<mutex> guard(compression_buffer_lock);
+	compression_buffers.push_back(std::move(compressed_buffer));
+	return result;
+}
+
+bool StandardBufferManager::ReserveCompressedMemory(idx_t size, idx_t compressed_memory_limit) {
+	auto current_memory = compressed_memory.load();
+	do {
+		if (current_memory + size > compressed_memory_limit) {
+			return false;
+		}
+	} while (!compressed_memory.compare_exchange_weak(current_memory, current_memory + size));
+	return true;
+}
+
+unique_ptr<FileBuffer> StandardBufferManager::DecompressTemporaryBuffer(block_id_t id, AllocatedData &compressed_data,
+                                                                        unique_ptr<FileBuffer> reusable_buffer) {
+	auto buffer = ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	DecompressTemporaryBlock(*buffer, compressed_data.get(), compressed_data.GetSize(), id);
+	return buffer;
+}
+
+void StandardBufferManager::FreeCompressedTemporaryBuffer(AllocatedData &compressed_data) {
+	D_ASSERT(compressed_memory >= compressed_data.GetSize());
+	compressed_memory -= compressed_data.GetSize();
+	compressed_data.Reset();
+}
+
 bool StandardBufferManager::HasTemporaryDirectory() const {
 	return !temp_directory.empty();
 }
@@ -711,10 +908,17 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		if (!StringUtil::EndsWith(name, ".block")) {
 			return;
 		}
+		// files outside of the temporary file manager hold a single buffer, preceded by its size
 		TemporaryFileInformation info;
 		info.path = name;
 		auto handle = fs.OpenFile(name, FileFlags::FILE_FLAGS_READ);
 		info.size = fs.GetFileSize(*handle);
+		info.block_size = 0;
+		info.block_count = 0;
+		if (info.size >= sizeof(idx_t)) {
+			handle->Read(&info.block_size, sizeof(idx_t), 0);
+			info.block_count = 1;
+		}
 		handle.reset();
 		result.push_back(info);
 	});
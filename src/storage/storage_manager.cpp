@@ -195,11 +195,12 @@ SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &stora
 void SingleFileStorageCommitState::FlushCommit() {
 	if (log) {
 		// flush the WAL if any changes were made
+		// the transaction manager waits for the WAL to be synced after releasing the transaction lock
 		if (log->GetTotalWritten() > initial_written) {
 			(void)checkpoint;
 			D_ASSERT(!checkpoint);
 			D_ASSERT(!log->skip_writing);
-			log->Flush();
+			log->WriteFlush();
 		}
 		log->skip_writing = false;
 	}
@@ -225,6 +226,9 @@ void SingleFileStorageManager::CreateCheckpoint(bool delete_wal, bool force_chec
 		// we only need to checkpoint if there is anything in the WAL
 		SingleFileCheckpointWriter checkpointer(db, *block_manager);
 		checkpointer.CreateCheckpoint();
+
+		lock_guard<mutex> guard(timings_lock);
+		last_checkpoint_timings = checkpointer.GetCheckpointTimings();
 	}
 	if (delete_wal) {
 		wal->Delete();
@@ -248,6 +252,11 @@ DatabaseSize SingleFileStorageManager::GetDatabaseSize() {
 	return ds;
 }
 
+CheckpointTimings SingleFileStorageManager::GetCheckpointTimings() {
+	lock_guard<mutex> guard(timings_lock);
+	return last_checkpoint_timings;
+}
+
 bool SingleFileStorageManager::AutomaticCheckpoint(idx_t estimated_wal_bytes) {
 	auto log = GetWriteAheadLog();
 	if (!log) {
@@ -138,6 +138,7 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 
 	if (!segment->stats.statistics.IsConstant()) {
 		// non-constant block
+		auto partial_block_lock = partial_block_manager.GetLock();
 		PartialBlockAllocation allocation = partial_block_manager.GetBlockAllocation(segment_size);
 		block_id = allocation.state.block_id;
 		offset_in_block = allocation.state.offset_in_block;
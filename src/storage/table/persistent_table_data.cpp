@@ -4,7 +4,7 @@
 namespace duckdb {
 
 PersistentTableData::PersistentTableData(idx_t column_count)
-    : total_rows(0), row_group_count(0), block_id(INVALID_BLOCK), offset(0) {
+    : total_rows(0), row_group_count(0), block_id(INVALID_BLOCK), offset(0), lazy_load(false) {
 }
 
 PersistentTableData::~PersistentTableData() {
@@ -9,6 +9,12 @@
 #include "duckdb/storage/meta_block_reader.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/checkpoint_timings.hpp"
+#include "duckdb/common/profiler.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
@@ -16,21 +22,38 @@ namespace duckdb {
 // Row Group Segment Tree
 //===--------------------------------------------------------------------===//
 RowGroupSegmentTree::RowGroupSegmentTree(RowGroupCollection &collection)
-    : SegmentTree<RowGroup, true>(), collection(collection), current_row_group(0), max_row_group(0) {
+    : SegmentTree<RowGroup, true>(), collection(collection), lazy_load(false), current_row_group(0),
+      max_row_group(0) {
 }
 RowGroupSegmentTree::~RowGroupSegmentTree() {
 }
 
 void RowGroupSegmentTree::Initialize(PersistentTableData &data) {
-	D_ASSERT(data.row_group_count > 0);
 	current_row_group = 0;
-	max_row_group = data.row_group_count;
 	finished_loading = false;
-	reader = make_uniq<MetaBlockReader>(collection.GetBlockManager(), data.block_id);
-	reader->offset = data.offset;
+	if (data.lazy_load) {
+		// the row group pointers follow the table statistics - we open the reader when the first row group is loaded
+		lazy_load = true;
+		return;
+	}
+	D_ASSERT(data.row_group_count > 0);
+	max_row_group = data.row_group_count;
+	InitializeReader(data.block_id, data.offset);
+}
+
+void RowGroupSegmentTree::InitializeReader(block_id_t block_id, idx_t offset) {
+	reader = make_uniq<MetaBlockReader>(collection.GetBlockManager(), block_id);
+	reader->offset = offset;
 }
 
 unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
+	if (lazy_load) {
+		// load the table statistics first: the row group pointers are stored directly after them
+		auto pointer = collection.GetStatistics().LoadLazy();
+		InitializeReader(pointer.block_id, pointer.offset);
+		max_row_group = reader->Read<uint64_t>();
+		lazy_load = false;
+	}
 	if (current_row_group >= max_row_group) {
 		finished_loading = true;
 		return nullptr;
@@ -77,8 +100,12 @@ void RowGroupCollection::Initialize(PersistentTableData &data) {
 	D_ASSERT(this->row_start == 0);
 	auto l = row_groups->Lock();
 	this->total_rows = data.total_rows;
+	if (data.lazy_load) {
+		stats.InitializeLazy(types, block_manager, BlockPointer(data.block_id, data.offset));
+	} else {
+		stats.Initialize(types, data);
+	}
 	row_groups->Initialize(data);
-	stats.Initialize(types, data);
 }
 
 void RowGroupCollection::InitializeEmpty() {
@@ -598,12 +625,67 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
+class CheckpointTask : public BaseExecutorTask {
+public:
+	CheckpointTask(TaskExecutor &executor, RowGroup &row_group, RowGroupWriter &writer, RowGroupWriteData &write_data)
+	    : BaseExecutorTask(executor), row_group(row_group), writer(writer), write_data(write_data) {
+	}
+
+	void ExecuteTask() override {
+		write_data = row_group.WriteToDisk(writer);
+	}
+
+private:
+	RowGroup &row_group;
+	RowGroupWriter &writer;
+	RowGroupWriteData &write_data;
+};
+
 void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &global_stats) {
+	auto &db = GetDatabase();
+	auto &timings = writer.GetCheckpointTimings();
+	vector<reference<RowGroup>> segments;
 	for (auto &row_group : row_groups->Segments()) {
-		auto rowg_writer = writer.GetRowGroupWriter(row_group);
-		auto pointer = row_group.Checkpoint(*rowg_writer, global_stats);
-		writer.AddRowGroup(std::move(pointer), std::move(rowg_writer));
+		segments.push_back(row_group);
+	}
+	timings.row_group_count += segments.size();
+
+	// compress the row groups and write their data to disk
+	// this can be done in parallel: the block allocations are synchronized by the PartialBlockManager
+	Profiler profiler;
+	profiler.Start();
+	vector<unique_ptr<RowGroupWriter>> rowg_writers;
+	vector<RowGroupWriteData> write_data(segments.size());
+	for (auto &row_group : segments) {
+		rowg_writers.push_back(writer.GetRowGroupWriter(row_group));
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db);
+	bool parallel = DBConfig::GetConfig(db).options.parallel_checkpoint && scheduler.NumberOfThreads() > 1 &&
+	                segments.size() > 1;
+	if (parallel) {
+		TaskExecutor executor(scheduler);
+		for (idx_t i = 0; i < segments.size(); i++) {
+			auto task = make_uniq<CheckpointTask>(executor, segments[i].get(), *rowg_writers[i], write_data[i]);
+			executor.ScheduleTask(std::move(task));
+		}
+		executor.WorkOnTasks();
+		timings.parallel = true;
+	} else {
+		for (idx_t i = 0; i < segments.size(); i++) {
+			write_data[i] = segments[i].get().WriteToDisk(*rowg_writers[i]);
+		}
+	}
+	profiler.End();
+	timings.write_row_group_data += profiler.Elapsed();
+
+	// write the data pointers of the row groups in order - this keeps the metadata deterministic
+	profiler.Start();
+	for (idx_t i = 0; i < segments.size(); i++) {
+		auto pointer = segments[i].get().Checkpoint(std::move(write_data[i]), *rowg_writers[i], global_stats);
+		writer.AddRowGroup(std::move(pointer), std::move(rowg_writers[i]));
 	}
+	profiler.End();
+	timings.write_table_metadata += profiler.Elapsed();
 }
 
 //===--------------------------------------------------------------------===//
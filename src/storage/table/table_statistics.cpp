@@ -1,5 +1,7 @@
 #include "duckdb/storage/table/table_statistics.hpp"
 #include "duckdb/storage/table/persistent_table_data.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/meta_block_reader.hpp"
 
 namespace duckdb {
 
@@ -20,8 +22,42 @@ void TableStatistics::InitializeEmpty(const vector<LogicalType> &types) {
 	}
 }
 
+void TableStatistics::InitializeLazy(const vector<LogicalType> &types, BlockManager &block_manager_p,
+                                     BlockPointer pointer) {
+	D_ASSERT(Empty());
+
+	lazy_types = types;
+	block_manager = &block_manager_p;
+	lazy_pointer = pointer;
+	lazy = true;
+}
+
+BlockPointer TableStatistics::LoadLazy() {
+	if (!lazy) {
+		return lazy_pointer;
+	}
+	lock_guard<mutex> l(load_lock);
+	if (!lazy) {
+		return lazy_pointer;
+	}
+	MetaBlockReader reader(*block_manager, lazy_pointer.block_id);
+	reader.offset = lazy_pointer.offset;
+	vector<shared_ptr<ColumnStatistics>> result;
+	for (auto &type : lazy_types) {
+		result.push_back(ColumnStatistics::Deserialize(reader, type));
+	}
+	{
+		lock_guard<mutex> stats_guard(stats_lock);
+		column_stats = std::move(result);
+	}
+	lazy_pointer = BlockPointer(reader.block->BlockId(), reader.offset);
+	lazy = false;
+	return lazy_pointer;
+}
+
 void TableStatistics::InitializeAddColumn(TableStatistics &parent, const LogicalType &new_column_type) {
 	D_ASSERT(Empty());
+	parent.LoadLazy();
 
 	lock_guard<mutex> stats_lock(parent.stats_lock);
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
@@ -32,6 +68,7 @@ void TableStatistics::InitializeAddColumn(TableStatistics &parent, const Logical
 
 void TableStatistics::InitializeRemoveColumn(TableStatistics &parent, idx_t removed_column) {
 	D_ASSERT(Empty());
+	parent.LoadLazy();
 
 	lock_guard<mutex> stats_lock(parent.stats_lock);
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
@@ -43,6 +80,7 @@ void TableStatistics::InitializeRemoveColumn(TableStatistics &parent, idx_t remo
 
 void TableStatistics::InitializeAlterType(TableStatistics &parent, idx_t changed_idx, const LogicalType &new_type) {
 	D_ASSERT(Empty());
+	parent.LoadLazy();
 
 	lock_guard<mutex> stats_lock(parent.stats_lock);
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
@@ -56,6 +94,7 @@ void TableStatistics::InitializeAlterType(TableStatistics &parent, idx_t changed
 
 void TableStatistics::InitializeAddConstraint(TableStatistics &parent) {
 	D_ASSERT(Empty());
+	parent.LoadLazy();
 
 	lock_guard<mutex> stats_lock(parent.stats_lock);
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
@@ -64,6 +103,8 @@ void TableStatistics::InitializeAddConstraint(TableStatistics &parent) {
 }
 
 void TableStatistics::MergeStats(TableStatistics &other) {
+	LoadLazy();
+	other.LoadLazy();
 	auto l = GetLock();
 	D_ASSERT(column_stats.size() == other.column_stats.size());
 	for (idx_t i = 0; i < column_stats.size(); i++) {
@@ -81,10 +122,12 @@ void TableStatistics::MergeStats(TableStatisticsLock &lock, idx_t i, BaseStatist
 }
 
 ColumnStatistics &TableStatistics::GetStats(idx_t i) {
+	LoadLazy();
 	return *column_stats[i];
 }
 
 unique_ptr<BaseStatistics> TableStatistics::CopyStats(idx_t i) {
+	LoadLazy();
 	lock_guard<mutex> l(stats_lock);
 	auto result = column_stats[i]->Statistics().Copy();
 	if (column_stats[i]->HasDistinctStats()) {
@@ -94,12 +137,14 @@ unique_ptr<BaseStatistics> TableStatistics::CopyStats(idx_t i) {
 }
 
 void TableStatistics::CopyStats(TableStatistics &other) {
+	LoadLazy();
 	for (auto &stats : column_stats) {
 		other.column_stats.push_back(stats->Copy());
 	}
 }
 
 void TableStatistics::Serialize(Serializer &serializer) {
+	LoadLazy();
 	for (auto &stats : column_stats) {
 		stats->Serialize(serializer);
 	}
@@ -113,6 +158,8 @@ void TableStatistics::Deserialize(Deserializer &source, ColumnList &columns) {
 }
 
 unique_ptr<TableStatisticsLock> TableStatistics::GetLock() {
+	// make sure the statistics are loaded before locking them
+	LoadLazy();
 	return make_uniq<TableStatisticsLock>(stats_lock);
 }
 
@@ -2,6 +2,7 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/common/string_util.hpp"
@@ -15,14 +16,256 @@
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// WAL Decoder
+//===--------------------------------------------------------------------===//
+struct DecodedWALEntry {
+	WALType type = WALType::INVALID;
+	//! The data of INSERT_TUPLE, DELETE_TUPLE and UPDATE_TUPLE entries
+	unique_ptr<DataChunk> chunk;
+	//! The column path of UPDATE_TUPLE entries
+	vector<column_t> column_path;
+	//! The table of USE_TABLE entries
+	string schema_name;
+	string table_name;
+	//! Whether or not the WAL is exhausted after this WAL_FLUSH entry
+	bool finished = false;
+	//! Whether or not the entry is handed over to the replaying thread, which reads it from its own reader
+	bool handed_over = false;
+	//! The offset at which a handed over entry starts
+	idx_t offset = 0;
+};
+
+//! The reader of the WALDecoder, which does not have a client context
+class WALDecoderReader : public BufferedFileReader {
+public:
+	WALDecoderReader(FileSystem &fs, const string &path) : BufferedFileReader(fs, path.c_str(), nullptr) {
+	}
+
+	ClientContext &GetContext() override {
+		// the entry is handed over to the replaying thread
+		throw SerializationException("WAL entry cannot be decoded without a client context");
+	}
+};
+
+//! The WALDecoder deserializes the data entries of the WAL (USE_TABLE, INSERT_TUPLE, DELETE_TUPLE and UPDATE_TUPLE) in
+//! tasks that are run by the task scheduler, so that decoding the next entries overlaps with replaying the current
+//! ones. The decoder reads the WAL through its own file handle, and does not use a client context.
+//! Any other entry (or a data entry that cannot be decoded without a client context, e.g. because it contains an
+//! ENUM type that is stored in the catalog) is handed over to the replaying thread, which reads it at its offset from
+//! its own reader. The decoder does not decode any further entries until it is resumed at the end of that entry.
+class WALDecoder : public std::enable_shared_from_this<WALDecoder> {
+public:
+	WALDecoder(DatabaseInstance &db, const string &path)
+	    : scheduler(TaskScheduler::GetScheduler(db)), producer(scheduler.CreateProducer()),
+	      source(make_uniq<WALDecoderReader>(FileSystem::GetFileSystem(db), path)), decoding(false),
+	      task_scheduled(false), paused(false), exhausted(false), stopped(false) {
+	}
+
+	//! Start decoding entries in the background (if there are threads to decode them on)
+	void Start() {
+		lock_guard<mutex> guard(lock);
+		ScheduleDecode();
+	}
+
+	//! Returns the next entry of the WAL - if it has not been decoded yet, it is decoded right away
+	DecodedWALEntry Next() {
+		unique_lock<mutex> guard(lock);
+		while (entries.empty()) {
+			if (paused || exhausted) {
+				throw InternalException("WALDecoder::Next called after the WAL was exhausted or handed over");
+			}
+			if (decoding) {
+				state_changed.wait(guard);
+			} else {
+				DecodeEntries(guard, 1);
+			}
+		}
+		auto entry = std::move(entries.front());
+		entries.pop_front();
+		ScheduleDecode();
+		return entry;
+	}
+
+	//! Continue decoding at the given offset, after an entry that was handed over has been replayed
+	void Resume(idx_t offset) {
+		lock_guard<mutex> guard(lock);
+		D_ASSERT(paused && !decoding);
+		source->Seek(offset);
+		paused = false;
+		ScheduleDecode();
+	}
+
+	//! Stop decoding, and close the file handle of the decoder - any decode task that is still scheduled is a no-op
+	void Stop() {
+		unique_lock<mutex> guard(lock);
+		stopped = true;
+		state_changed.wait(guard, [&]() { return !decoding; });
+		source.reset();
+	}
+
+	//! Decode entries until the queue is full, or an entry is handed over - called from the decode task
+	void Decode() {
+		unique_lock<mutex> guard(lock);
+		task_scheduled = false;
+		if (decoding) {
+			return;
+		}
+		DecodeEntries(guard, MAX_DECODED_ENTRIES);
+	}
+
+private:
+	//! The maximum amount of decoded entries that are waiting to be replayed
+	static constexpr const idx_t MAX_DECODED_ENTRIES = 64;
+
+	//! Schedule a decode task if there is room in the queue, and no decoder is running or scheduled yet
+	void ScheduleDecode();
+
+	//! Decode entries until there are max_entries in the queue - the lock is released while decoding an entry
+	void DecodeEntries(unique_lock<mutex> &guard, idx_t max_entries) {
+		decoding = true;
+		while (!stopped && !paused && !exhausted && entries.size() < max_entries) {
+			guard.unlock();
+			auto entry = DecodeEntry();
+			guard.lock();
+			paused = entry.handed_over;
+			exhausted = entry.finished;
+			entries.push_back(std::move(entry));
+		}
+		decoding = false;
+		state_changed.notify_all();
+	}
+
+	//! Reads the next entry from the source, deserializing it if it is a data entry
+	DecodedWALEntry DecodeEntry() {
+		DecodedWALEntry entry;
+		auto offset = source->CurrentOffset();
+		try {
+			entry.type = source->Read<WALType>();
+			switch (entry.type) {
+			case WALType::USE_TABLE:
+				entry.schema_name = source->Read<string>();
+				entry.table_name = source->Read<string>();
+				return entry;
+			case WALType::INSERT_TUPLE:
+			case WALType::DELETE_TUPLE:
+				entry.chunk = make_uniq<DataChunk>();
+				entry.chunk->Deserialize(*source);
+				return entry;
+			case WALType::UPDATE_TUPLE: {
+				auto column_index_count = source->Read<idx_t>();
+				entry.column_path.reserve(column_index_count);
+				for (idx_t i = 0; i < column_index_count; i++) {
+					entry.column_path.push_back(source->Read<column_t>());
+				}
+				entry.chunk = make_uniq<DataChunk>();
+				entry.chunk->Deserialize(*source);
+				return entry;
+			}
+			case WALType::WAL_FLUSH:
+				entry.finished = source->Finished();
+				return entry;
+			default:
+				break;
+			}
+		} catch (std::exception &) {
+			// the entry cannot be decoded without a client context (or the WAL is corrupt)
+			// the replaying thread reads the entry, and reports the error if it fails as well
+		}
+		DecodedWALEntry handed_over_entry;
+		handed_over_entry.handed_over = true;
+		handed_over_entry.offset = offset;
+		return handed_over_entry;
+	}
+
+private:
+	TaskScheduler &scheduler;
+	unique_ptr<ProducerToken> producer;
+	//! The reader of the decoder, which uses its own file handle
+	unique_ptr<WALDecoderReader> source;
+	mutex lock;
+	std::condition_variable state_changed;
+	//! The decoded entries that are waiting to be replayed
+	deque<DecodedWALEntry> entries;
+	//! Whether or not entries are being decoded (by a decode task or by the replaying thread)
+	bool decoding;
+	//! Whether or not a decode task is scheduled
+	bool task_scheduled;
+	//! Whether or not the decoder is waiting for the replaying thread to resume it
+	bool paused;
+	//! Whether or not the decoder has reached the end of the WAL
+	bool exhausted;
+	//! Whether or not the decoder has been stopped
+	bool stopped;
+};
+
+class WALDecodeTask : public Task {
+public:
+	explicit WALDecodeTask(shared_ptr<WALDecoder> decoder_p) : decoder(std::move(decoder_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		decoder->Decode();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<WALDecoder> decoder;
+};
+
+void WALDecoder::ScheduleDecode() {
+#ifndef DUCKDB_NO_THREADS
+	if (scheduler.NumberOfThreads() <= 1) {
+		// there are no threads to decode on: the replaying thread decodes the entries when it needs them
+		return;
+	}
+	if (decoding || task_scheduled || paused || exhausted || stopped || entries.size() >= MAX_DECODED_ENTRIES / 2) {
+		return;
+	}
+	task_scheduled = true;
+	scheduler.ScheduleTask(*producer, make_shared<WALDecodeTask>(shared_from_this()));
+#endif
+}
+
+static void ReplayDecodedEntry(ReplayState &state, WALDecoder &decoder, BufferedFileReader &reader,
+                               DecodedWALEntry &entry) {
+	if (entry.handed_over) {
+		// the decoder has handed over the entry to us: read and replay it from our own reader
+		reader.Seek(entry.offset);
+		state.ReplayEntry(reader.Read<WALType>());
+		decoder.Resume(reader.CurrentOffset());
+		return;
+	}
+	switch (entry.type) {
+	case WALType::USE_TABLE:
+		state.ReplayUseTable(entry.schema_name, entry.table_name);
+		break;
+	case WALType::INSERT_TUPLE:
+		state.ReplayInsert(*entry.chunk);
+		break;
+	case WALType::DELETE_TUPLE:
+		state.ReplayDelete(*entry.chunk);
+		break;
+	case WALType::UPDATE_TUPLE:
+		state.ReplayUpdate(entry.column_path, *entry.chunk);
+		break;
+	default:
+		throw InternalException("Unexpected decoded WAL entry type");
+	}
+}
+
 bool WriteAheadLog::Replay(AttachedDatabase &database, string &path) {
 	Connection con(database.GetDatabase());
 	auto initial_reader = make_uniq<BufferedFileReader>(FileSystem::Get(database), path.c_str(), con.context.get());
@@ -80,15 +323,19 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, string &path) {
 	// note that everything is wrapped inside a try/catch block here
 	// there can be errors in WAL replay because of a corrupt WAL file
 	// in this case we should throw a warning but startup anyway
+	// the data entries are decoded in the background while we replay them
+	auto decoder = make_shared<WALDecoder>(database.GetDatabase(), path);
 	try {
+		decoder->Start();
 		while (true) {
 			// read the current entry
-			WALType entry_type = reader.Read<WALType>();
-			if (entry_type == WALType::WAL_FLUSH) {
+			auto entry = decoder->Next();
+			if (!entry.handed_over && entry.type == WALType::WAL_FLUSH) {
 				// flush: commit the current transaction
+				state.FlushAppend();
 				con.Commit();
 				// check if the file is exhausted
-				if (reader.Finished()) {
+				if (entry.finished) {
 					// we finished reading the file: break
 					break;
 				}
@@ -96,15 +343,18 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, string &path) {
 				con.BeginTransaction();
 			} else {
 				// replay the entry
-				state.ReplayEntry(entry_type);
+				ReplayDecodedEntry(state, *decoder, reader, entry);
 			}
 		}
+		decoder->Stop();
 	} catch (std::exception &ex) { // LCOV_EXCL_START
+		decoder->Stop();
 		// FIXME: this should report a proper warning in the connection
 		Printer::Print(StringUtil::Format("Exception in WAL playback: %s\n", ex.what()));
 		// exception thrown in WAL replay: rollback
 		con.Rollback();
 	} catch (...) {
+		decoder->Stop();
 		Printer::Print("Unknown Exception in WAL playback: %s\n");
 		// exception thrown in WAL replay: rollback
 		con.Rollback();
@@ -115,7 +365,18 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, string &path) {
 //===--------------------------------------------------------------------===//
 // Replay Entries
 //===--------------------------------------------------------------------===//
+ReplayState::ReplayState(AttachedDatabase &db, ClientContext &context, Deserializer &source)
+    : db(db), context(context), catalog(db.GetCatalog()), source(source), deserialize_only(false),
+      checkpoint_id(INVALID_BLOCK) {
+}
+
+ReplayState::~ReplayState() {
+}
+
 void ReplayState::ReplayEntry(WALType entry_type) {
+	if (entry_type != WALType::USE_TABLE && entry_type != WALType::INSERT_TUPLE) {
+		FlushAppend();
+	}
 	switch (entry_type) {
 	case WALType::CREATE_TABLE:
 		ReplayCreateTable();
@@ -456,6 +717,10 @@ void ReplayState::ReplayUseTable() {
 	if (deserialize_only) {
 		return;
 	}
+	ReplayUseTable(schema_name, table_name);
+}
+
+void ReplayState::ReplayUseTable(const string &schema_name, const string &table_name) {
 	current_table = &catalog.GetEntry<TableCatalogEntry>(context, schema_name, table_name);
 }
 
@@ -465,12 +730,33 @@ void ReplayState::ReplayInsert() {
 	if (deserialize_only) {
 		return;
 	}
+	ReplayInsert(chunk);
+}
+
+void ReplayState::ReplayInsert(DataChunk &chunk) {
 	if (!current_table) {
 		throw Exception("Corrupt WAL: insert without table");
 	}
-
+	// consecutive inserts into the same table are appended using a single append state
+	// such that they are bulk loaded into the row groups of the transaction-local storage
+	if (append_table.get() != current_table.get()) {
+		FlushAppend();
+		append_state = make_uniq<LocalAppendState>();
+		current_table->GetStorage().InitializeLocalAppend(*append_state, context);
+		append_table = current_table;
+	}
 	// append to the current table
-	current_table->GetStorage().LocalAppend(*current_table, context, chunk);
+	// the constraints have been verified when the data was committed, so we do not need to verify them again
+	append_table->GetStorage().LocalAppend(*append_state, *append_table, context, chunk, true);
+}
+
+void ReplayState::FlushAppend() {
+	if (!append_table) {
+		return;
+	}
+	append_table->GetStorage().FinalizeLocalAppend(*append_state);
+	append_state.reset();
+	append_table = nullptr;
 }
 
 void ReplayState::ReplayDelete() {
@@ -479,9 +765,14 @@ void ReplayState::ReplayDelete() {
 	if (deserialize_only) {
 		return;
 	}
+	ReplayDelete(chunk);
+}
+
+void ReplayState::ReplayDelete(DataChunk &chunk) {
 	if (!current_table) {
 		throw InternalException("Corrupt WAL: delete without table");
 	}
+	FlushAppend();
 
 	D_ASSERT(chunk.ColumnCount() == 1 && chunk.data[0].GetType() == LogicalType::ROW_TYPE);
 	row_t row_ids[1];
@@ -507,9 +798,14 @@ void ReplayState::ReplayUpdate() {
 	if (deserialize_only) {
 		return;
 	}
+	ReplayUpdate(column_path, chunk);
+}
+
+void ReplayState::ReplayUpdate(const vector<column_t> &column_path, DataChunk &chunk) {
 	if (!current_table) {
 		throw InternalException("Corrupt WAL: update without table");
 	}
+	FlushAppend();
 
 	if (column_path[0] >= current_table->GetColumns().PhysicalColumnCount()) {
 		throw InternalException("Corrupt WAL: column index for update out of bounds");
@@ -11,7 +11,9 @@
 
 namespace duckdb {
 
-WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &path) : skip_writing(false), database(database) {
+WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &path)
+    : skip_writing(false), database(database), written_flush_id(0), synced_flush_id(0), sync_in_progress(false),
+      active_syncs(0) {
 	wal_path = path;
 	writer = make_uniq<BufferedFileWriter>(FileSystem::Get(database), path.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE |
@@ -19,6 +21,7 @@ WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &path) : s
 }
 
 WriteAheadLog::~WriteAheadLog() {
+	WaitForSyncs();
 }
 
 int64_t WriteAheadLog::GetWALSize() {
@@ -39,6 +42,7 @@ void WriteAheadLog::Delete() {
 	if (!writer) {
 		return;
 	}
+	WaitForSyncs();
 	writer.reset();
 
 	auto &fs = FileSystem::Get(database);
@@ -296,10 +300,64 @@ void WriteAheadLog::Flush() {
 	if (skip_writing) {
 		return;
 	}
+	SyncFlush(WriteFlush());
+}
+
+idx_t WriteAheadLog::WriteFlush() {
+	D_ASSERT(!skip_writing);
 	// write an empty entry
 	writer->Write<WALType>(WALType::WAL_FLUSH);
-	// flushes all changes made to the WAL to disk
-	writer->Sync();
+	// write all changes made to the WAL to the file - syncing the file is done in SyncFlush
+	writer->Flush();
+	return ++written_flush_id;
+}
+
+idx_t WriteAheadLog::GetLastFlushId() {
+	return written_flush_id;
+}
+
+void WriteAheadLog::SyncFlush(idx_t flush_id) {
+	unique_lock<mutex> guard(sync_lock);
+	active_syncs++;
+	while (synced_flush_id < flush_id && sync_error.empty()) {
+		if (sync_in_progress) {
+			// another thread is syncing the file - wait for it to finish
+			// if the sync does not cover our flush, one of the waiting threads will start the next sync
+			sync_finished.wait(guard);
+			continue;
+		}
+		// sync the file on behalf of all flushes that have been written to it so far
+		sync_in_progress = true;
+		idx_t sync_target = written_flush_id;
+		guard.unlock();
+		string error;
+		try {
+			writer->handle->Sync();
+		} catch (std::exception &ex) {
+			error = ex.what();
+		}
+		guard.lock();
+		sync_in_progress = false;
+		if (error.empty()) {
+			synced_flush_id = MaxValue<idx_t>(synced_flush_id, sync_target);
+		} else {
+			sync_error = error;
+		}
+		sync_finished.notify_all();
+	}
+	active_syncs--;
+	if (active_syncs == 0) {
+		sync_finished.notify_all();
+	}
+	if (synced_flush_id < flush_id) {
+		// we cannot know which of the changes in the WAL have made it to disk
+		throw FatalException("Failed to sync the write-ahead log: %s", sync_error);
+	}
+}
+
+void WriteAheadLog::WaitForSyncs() {
+	unique_lock<mutex> guard(sync_lock);
+	sync_finished.wait(guard, [&] { return active_syncs == 0; });
 }
 
 } // namespace duckdb
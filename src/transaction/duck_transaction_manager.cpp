@@ -9,9 +9,13 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
+
+#include <chrono>
 
 namespace duckdb {
 
@@ -41,7 +45,9 @@ struct CheckpointLock {
 };
 
 DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db)
-    : TransactionManager(db), thread_is_checkpointing(false) {
+    : TransactionManager(db), thread_is_checkpointing(false), block_new_transactions(false),
+      checkpoint_requested(false), checkpoint_deferred(false), checkpoint_retry_wal_size(0),
+      stop_background_checkpoints(false) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
 	// transaction ID starts very high:
@@ -54,6 +60,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db)
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpoints();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -66,7 +73,9 @@ DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
 
 Transaction *DuckTransactionManager::StartTransaction(ClientContext &context) {
 	// obtain the transaction lock during this function
-	lock_guard<mutex> lock(transaction_lock);
+	unique_lock<mutex> lock(transaction_lock);
+	// if a background checkpoint is waiting for the active transactions to finish, wait for it to complete first
+	transaction_state_changed.wait(lock, [&]() { return !block_new_transactions; });
 	if (current_start_timestamp >= TRANSACTION_ID_START) { // LCOV_EXCL_START
 		throw InternalException("Cannot start more transactions, ran out of "
 		                        "transaction identifiers!");
@@ -118,22 +127,28 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	}
 
 	// first check if no other thread is checkpointing right now
+	// a running background checkpoint is waited for, as it only blocks new transactions for a short while
 	auto lock = unique_lock<mutex>(transaction_lock);
+	transaction_state_changed.wait(lock, [&]() { return !block_new_transactions; });
 	if (thread_is_checkpointing) {
 		throw TransactionException("Cannot CHECKPOINT: another thread is checkpointing right now");
 	}
 	CheckpointLock checkpoint_lock(*this);
 	checkpoint_lock.Lock();
-	lock.unlock();
 
-	// lock all the clients AND the connection manager now
-	// this ensures no new queries can be started, and no new connections to the database can be made
-	// to avoid deadlock we release the transaction lock while locking the clients
 	vector<ClientLockWrapper> client_locks;
-	LockClients(client_locks, context);
+	if (force) {
+		// lock all the clients AND the connection manager now
+		// this ensures no new queries can be started, and no new connections to the database can be made
+		// to avoid deadlock we release the transaction lock while locking the clients
+		lock.unlock();
+		LockClients(client_locks, context);
+		lock.lock();
+	}
+	// if we are not forcing the checkpoint we do not need to lock the clients: holding the transaction lock prevents
+	// any new transactions from being started while we checkpoint
 
 	auto current = &DuckTransaction::Get(context, db);
-	lock.lock();
 	if (current->ChangesMade()) {
 		throw TransactionException("Cannot CHECKPOINT: the current transaction has transaction local changes");
 	}
@@ -164,6 +179,90 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint();
 }
 
+void DuckTransactionManager::RequestBackgroundCheckpoint() {
+#ifndef DUCKDB_NO_THREADS
+	if (stop_background_checkpoints) {
+		return;
+	}
+	auto log = db.GetStorageManager().GetWriteAheadLog();
+	if (log && idx_t(log->GetWALSize()) < checkpoint_retry_wal_size) {
+		// an earlier background checkpoint was deferred because of long-running transactions
+		// only try again once the WAL has grown by another checkpoint threshold
+		return;
+	}
+	checkpoint_requested = true;
+	if (!checkpoint_thread) {
+		checkpoint_thread = make_uniq<thread>([this]() { RunBackgroundCheckpoints(); });
+	}
+	transaction_state_changed.notify_all();
+#endif
+}
+
+void DuckTransactionManager::RunBackgroundCheckpoints() {
+	auto &storage_manager = db.GetStorageManager();
+	unique_lock<mutex> lock(transaction_lock);
+	while (true) {
+		transaction_state_changed.wait(lock, [&]() { return checkpoint_requested || stop_background_checkpoints; });
+		if (stop_background_checkpoints) {
+			return;
+		}
+		if (thread_is_checkpointing) {
+			// another thread is checkpointing already - this will truncate the WAL for us
+			checkpoint_requested = false;
+			continue;
+		}
+		CheckpointLock checkpoint_lock(*this);
+		checkpoint_lock.Lock();
+		// stop new transactions from starting, and wait (for a limited time) for the active transactions to finish
+		// we only block new transactions for a short while so that long-running transactions do not stall the system
+		block_new_transactions = true;
+		bool can_checkpoint = transaction_state_changed.wait_for(lock, std::chrono::milliseconds(100), [&]() {
+			return stop_background_checkpoints || CanCheckpoint();
+		});
+		if (can_checkpoint && !stop_background_checkpoints) {
+			checkpoint_requested = false;
+			// the WAL might have been checkpointed by a committing transaction in the meantime
+			if (storage_manager.AutomaticCheckpoint(0)) {
+				try {
+					storage_manager.CreateCheckpoint();
+				} catch (FatalException &ex) {
+					ValidChecker::Invalidate(db.GetDatabase(), ex.what());
+				} catch (std::exception &) {
+					// the checkpoint failed: the changes are still in the WAL, so we will retry on the next request
+				}
+			}
+		}
+		if (checkpoint_requested && !stop_background_checkpoints) {
+			// we could not checkpoint because there are long-running transactions
+			// we do not block new transactions again until either all transactions have finished, or the WAL has
+			// grown by another checkpoint threshold
+			checkpoint_requested = false;
+			checkpoint_deferred = true;
+			auto log = storage_manager.GetWriteAheadLog();
+			auto &config = DBConfig::Get(db);
+			checkpoint_retry_wal_size = (log ? idx_t(log->GetWALSize()) : 0) + config.options.checkpoint_wal_size;
+		} else {
+			checkpoint_deferred = false;
+			checkpoint_retry_wal_size = 0;
+		}
+		block_new_transactions = false;
+		checkpoint_lock.Unlock();
+		transaction_state_changed.notify_all();
+	}
+}
+
+void DuckTransactionManager::StopBackgroundCheckpoints() {
+	{
+		lock_guard<mutex> lock(transaction_lock);
+		stop_background_checkpoints = true;
+	}
+	transaction_state_changed.notify_all();
+	if (checkpoint_thread) {
+		checkpoint_thread->join();
+		checkpoint_thread.reset();
+	}
+}
+
 bool DuckTransactionManager::CanCheckpoint(optional_ptr<DuckTransaction> current) {
 	if (db.IsSystem()) {
 		return false;
@@ -185,34 +284,30 @@ bool DuckTransactionManager::CanCheckpoint(optional_ptr<DuckTransaction> current
 
 string DuckTransactionManager::CommitTransaction(ClientContext &context, Transaction *transaction_p) {
 	auto &transaction = transaction_p->Cast<DuckTransaction>();
-	vector<ClientLockWrapper> client_locks;
 	auto lock = make_uniq<lock_guard<mutex>>(transaction_lock);
 	CheckpointLock checkpoint_lock(*this);
 	// check if we can checkpoint
+	// if this is the only active transaction we can checkpoint right away: no new transactions can be started while we
+	// hold the transaction lock, so there is no need to lock the clients
 	bool checkpoint = thread_is_checkpointing ? false : CanCheckpoint(&transaction);
 	if (checkpoint) {
 		if (transaction.AutomaticCheckpoint(db)) {
 			checkpoint_lock.Lock();
-			// we might be able to checkpoint: lock all clients
-			// to avoid deadlock we release the transaction lock while locking the clients
-			lock.reset();
-
-			LockClients(client_locks, context);
-
-			lock = make_uniq<lock_guard<mutex>>(transaction_lock);
-			checkpoint = CanCheckpoint(&transaction);
-			if (!checkpoint) {
-				checkpoint_lock.Unlock();
-				client_locks.clear();
-			}
 		} else {
 			checkpoint = false;
 		}
 	}
 	// obtain a commit id for the transaction
 	transaction_t commit_id = current_start_timestamp++;
+	auto log = db.IsSystem() ? nullptr : db.GetStorageManager().GetWriteAheadLog();
+	idx_t flush_id = log ? log->GetLastFlushId() : 0;
 	// commit the UndoBuffer of the transaction
 	string error = transaction.Commit(db, commit_id, checkpoint);
+	// check if the commit wrote any changes to the WAL
+	bool sync_wal = log && log->GetLastFlushId() > flush_id;
+	if (sync_wal) {
+		flush_id = log->GetLastFlushId();
+	}
 	if (!error.empty()) {
 		// commit unsuccessful: rollback the transaction instead
 		checkpoint = false;
@@ -220,9 +315,8 @@ string DuckTransactionManager::CommitTransaction(ClientContext &context, Transac
 		transaction.Rollback();
 	}
 	if (!checkpoint) {
-		// we won't checkpoint after all: unlock the clients again
+		// we won't checkpoint after all
 		checkpoint_lock.Unlock();
-		client_locks.clear();
 	}
 
 	// commit successful: remove the transaction id from the list of active transactions
@@ -234,6 +328,18 @@ string DuckTransactionManager::CommitTransaction(ClientContext &context, Transac
 		// checkpoint the database to disk
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(false, true);
+	} else if (sync_wal && error.empty() && !thread_is_checkpointing && db.GetStorageManager().AutomaticCheckpoint(0)) {
+		// the WAL has grown past the checkpoint threshold, but other transactions are active
+		// checkpoint in the background as soon as they have finished
+		RequestBackgroundCheckpoint();
+	}
+	if (sync_wal) {
+		// the changes are written to the WAL, but the WAL might not be synced to disk yet
+		// we release the transaction lock before waiting for the sync, so that concurrent transactions can write their
+		// changes to the WAL in the meantime and share a single sync of the file with this transaction
+		D_ASSERT(!checkpoint);
+		lock.reset();
+		log->SyncFlush(flush_id);
 	}
 	return error;
 }
@@ -287,6 +393,15 @@ void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction) noe
 	}
 	// remove the transaction from the set of currently active transactions
 	active_transactions.erase(active_transactions.begin() + t_index);
+	if (active_transactions.empty()) {
+		if (checkpoint_deferred) {
+			// a background checkpoint was deferred because of this transaction: retry now that it has finished
+			checkpoint_deferred = false;
+			checkpoint_requested = true;
+		}
+		// wake up a background checkpoint that might be waiting for the active transactions to finish
+		transaction_state_changed.notify_all();
+	}
 	// traverse the recently_committed transactions to see if we can remove any
 	idx_t i = 0;
 	for (; i < recently_committed_transactions.size(); i++) {
@@ -0,0 +1,76 @@
+#include "catch.hpp"
+#include "duckdb/execution/operator/persistent/csv_sniff_cache.hpp"
+#include "test_helpers.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+static shared_ptr<CSVSniffCache> GetSniffCacheEntry(Connection &con, const string &csv_path) {
+	auto &cache = ObjectCache::GetObjectCache(*con.context);
+	return cache.Get<CSVSniffCache>(CSVSniffCache::ObjectType() + ":" + csv_path);
+}
+
+// the cache never trusts files that were modified right before they were sniffed, so we backdate the entry (and
+// replace its detected types with a marker that is only visible if the entry is actually used)
+static void BackdateSniffCacheEntry(CSVSniffCache &entry) {
+	entry.read_time = entry.last_modified + 3600;
+	for (auto &type : entry.return_types) {
+		type = LogicalType::VARCHAR;
+	}
+}
+
+TEST_CASE("Test reuse and invalidation of the CSV sniff cache", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	auto csv_path = TestCreatePath("sniff_cache_reuse.csv");
+
+	REQUIRE_NO_FAIL(con.Query("PRAGMA enable_object_cache"));
+	REQUIRE_NO_FAIL(con.Query("COPY (SELECT i, i * 2 AS j FROM range(10) t(i)) TO '" + csv_path + "' (HEADER 1)"));
+
+	auto query = "SELECT typeof(MIN(i)), typeof(MIN(j)), SUM(i::BIGINT) FROM read_csv_auto('" + csv_path + "')";
+	auto result = con.Query(query);
+	REQUIRE(CHECK_COLUMN(result, 0, {"BIGINT"}));
+	REQUIRE(CHECK_COLUMN(result, 1, {"BIGINT"}));
+	REQUIRE(CHECK_COLUMN(result, 2, {45}));
+
+	auto entry = GetSniffCacheEntry(con, csv_path);
+	REQUIRE(entry);
+	BackdateSniffCacheEntry(*entry);
+
+	// a second scan of the unchanged file uses the cached result instead of sniffing again
+	result = con.Query(query);
+	REQUIRE(CHECK_COLUMN(result, 0, {"VARCHAR"}));
+	REQUIRE(CHECK_COLUMN(result, 1, {"VARCHAR"}));
+	REQUIRE(CHECK_COLUMN(result, 2, {45}));
+	REQUIRE(GetSniffCacheEntry(con, csv_path) == entry);
+
+	// a different modification time invalidates the entry
+	entry->last_modified--;
+	entry->read_time = entry->last_modified + 3600;
+	result = con.Query(query);
+	REQUIRE(CHECK_COLUMN(result, 0, {"BIGINT"}));
+	REQUIRE(CHECK_COLUMN(result, 1, {"BIGINT"}));
+	REQUIRE(GetSniffCacheEntry(con, csv_path) != entry);
+
+	// so does a different file size
+	entry = GetSniffCacheEntry(con, csv_path);
+	REQUIRE(entry);
+	BackdateSniffCacheEntry(*entry);
+	entry->file_size++;
+	result = con.Query(query);
+	REQUIRE(CHECK_COLUMN(result, 0, {"BIGINT"}));
+	REQUIRE(CHECK_COLUMN(result, 1, {"BIGINT"}));
+	REQUIRE(GetSniffCacheEntry(con, csv_path) != entry);
+
+	// rewriting the file changes both, and the new schema is detected
+	entry = GetSniffCacheEntry(con, csv_path);
+	REQUIRE(entry);
+	BackdateSniffCacheEntry(*entry);
+	REQUIRE_NO_FAIL(
+	    con.Query("COPY (SELECT i, i * 0.5 AS j FROM range(100) t(i)) TO '" + csv_path + "' (HEADER 1)"));
+	result = con.Query(query);
+	REQUIRE(CHECK_COLUMN(result, 0, {"BIGINT"}));
+	REQUIRE(CHECK_COLUMN(result, 1, {"DOUBLE"}));
+	REQUIRE(CHECK_COLUMN(result, 2, {4950}));
+	REQUIRE(GetSniffCacheEntry(con, csv_path) != entry);
+}
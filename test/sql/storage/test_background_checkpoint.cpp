@@ -0,0 +1,66 @@
+#include "catch.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "test_helpers.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+static idx_t GetWALSize(FileSystem &fs, const string &wal_path) {
+	if (!fs.FileExists(wal_path)) {
+		return 0;
+	}
+	auto handle = fs.OpenFile(wal_path, FileFlags::FILE_FLAGS_READ);
+	return fs.GetFileSize(*handle);
+}
+
+TEST_CASE("Test that a deferred automatic checkpoint runs in the background", "[storage]") {
+	constexpr idx_t CHECKPOINT_THRESHOLD = 64 * 1024;
+
+	auto fs = FileSystem::CreateLocal();
+	auto config = GetTestConfig();
+	auto storage_database = TestCreatePath("background_checkpoint_test");
+	auto wal_path = storage_database + ".wal";
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		Connection con_long(db);
+		REQUIRE_NO_FAIL(con.Query("PRAGMA disable_checkpoint_on_shutdown"));
+		REQUIRE_NO_FAIL(con.Query("PRAGMA wal_autocheckpoint='64KB'"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER, s VARCHAR)"));
+
+		// a long-running transaction prevents checkpointing when the WAL reaches the threshold
+		REQUIRE_NO_FAIL(con_long.Query("BEGIN TRANSACTION"));
+		REQUIRE_NO_FAIL(con_long.Query("SELECT COUNT(*) FROM integers"));
+		for (idx_t i = 0; i < 20; i++) {
+			REQUIRE_NO_FAIL(con.Query("INSERT INTO integers SELECT " + to_string(i) +
+			                          ", repeat('x', 100) FROM range(100)"));
+		}
+		REQUIRE(GetWALSize(*fs, wal_path) > CHECKPOINT_THRESHOLD);
+
+		// once the long-running transaction has finished, the deferred checkpoint truncates the WAL in the background
+		REQUIRE_NO_FAIL(con_long.Query("COMMIT"));
+		auto wal_size = GetWALSize(*fs, wal_path);
+		for (idx_t attempt = 0; attempt < 100 && wal_size > CHECKPOINT_THRESHOLD; attempt++) {
+			this_thread::sleep_for(chrono::milliseconds(100));
+			wal_size = GetWALSize(*fs, wal_path);
+		}
+		REQUIRE(wal_size < CHECKPOINT_THRESHOLD);
+
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(2000)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(19000)}));
+	}
+	{
+		// the checkpointed data survives a restart
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(2000)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(19000)}));
+	}
+	DeleteDatabase(storage_database);
+}